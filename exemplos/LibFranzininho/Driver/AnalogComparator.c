@@ -11,17 +11,17 @@
 uint8_t AnalogComparator_GetChannelADC(uint8_t x);
 
 /** */
-//#define ADC_INPUT_CHANNEL(x)        \
-//{                                   \ 
-//	switch(x)                       \
-//	{                               \
-//		case AC1: return 0; break;  \
-//		case AC2: return 1; break;  \
-//		case AC3: return 2; break;  \
-//		case AC4: return 3; break;  \
-//		default return 0xFF; break; \
-//	}                               \
-//}
+/*#define ADC_INPUT_CHANNEL(x)        \
+{                                   \ 
+	switch(x)                       \
+	{                               \
+		case AC1: return 0; break;  \
+		case AC2: return 1; break;  \
+		case AC3: return 2; break;  \
+		case AC4: return 3; break;  \
+		default return 0xFF; break; \
+	}                               \
+}*/
 
 /**
  * @brief In ATtiny85 the analog comparator peripheral uses AIN0 (PB0) pin as 
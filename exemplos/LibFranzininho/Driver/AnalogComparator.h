@@ -8,4 +8,5 @@
 #include <stdbool.h>
 
 void AnalogComparator_Init(uint8_t pin);
-bool AnalogComparator_Read(void);
\ No newline at end of file
+bool AnalogComparator_Read(void);
+void AnalogComparator_EnableEvent(bool enable);
\ No newline at end of file
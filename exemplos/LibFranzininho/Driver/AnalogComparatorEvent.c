@@ -0,0 +1,37 @@
+/*
+ * AnalogComparatorEvent.c
+ *
+ * Created: 19/10/2026 10:18:05
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "AnalogComparator.h"
+#include "../Util/EventQueue.h"
+
+/**
+ * @brief Posts the new comparator output on every toggle. Kept apart from
+ *        AnalogComparator.c so polling users do not link the EventQueue.
+ */
+ISR (ANA_COMP_vect)
+{
+  EventQueue_Post(EVENT_COMPARATOR, (ACSR >> ACO) & 1);
+}
+
+/**
+ * @brief Posts an EVENT_COMPARATOR to the EventQueue when the output toggles
+ * @param enable
+ */
+void AnalogComparator_EnableEvent(bool enable)
+{
+  if(enable == true)
+  {
+    ACSR &= ~((1 << ACIS1) | (1 << ACIS0));  // interrupt on output toggle
+    ACSR |= (1 << ACI);                      // drop a stale flag
+    ACSR |= (1 << ACIE);
+    sei();
+  }
+  else
+  {
+    ACSR &= ~(1 << ACIE);
+  }
+}
@@ -33,4 +33,49 @@ uint16_t AnalogPin_Read(uint8_t pin)
 	ADCSRA |= (1<<ADSC);
 	while(ADCSRA & (1<<ADSC));
 	return (ADC);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Selects the ADC reference, shared by all channels
+ * @param ref ANALOG_PIN_REF_xxx
+ */
+void AnalogPin_SetReference(uint8_t ref)
+{
+	ADMUX = (ADMUX & ~ANALOG_PIN_REF_MASK) | (ref & ANALOG_PIN_REF_MASK);
+}
+
+/**
+ * @brief Connects a channel to the sample and hold capacitor without
+ *        starting a conversion
+ * @param channel ADC0..ADC3 or ANALOG_PIN_CH_xxx
+ */
+void AnalogPin_Select(uint8_t channel)
+{
+	ADMUX = (ADMUX & ~ANALOG_PIN_CH_MASK) | (channel & ANALOG_PIN_CH_MASK);
+}
+
+/**
+ * @brief Starts a conversion on the selected channel
+ */
+void AnalogPin_Start(void)
+{
+	ADCSRA |= (1 << ADSC);
+}
+
+/**
+ * @brief
+ * @return true while a conversion is running
+ */
+bool AnalogPin_IsBusy(void)
+{
+	return (ADCSRA & (1 << ADSC)) != 0;
+}
+
+/**
+ * @brief
+ * @return result of the last conversion
+ */
+uint16_t AnalogPin_GetResult(void)
+{
+	return (ADC);
+}
@@ -4,6 +4,26 @@
  * Created: 06/02/2021 07:36:33
  *  Author: evandro teixeira
  */ 
+#include <stdbool.h>
+#include <stdint.h>
 
 void AnalogPin_Init(void);
-uint16_t AnalogPin_Read(uint8_t pin);
\ No newline at end of file
+uint16_t AnalogPin_Read(uint8_t pin);
+
+/** @brief Values for AnalogPin_SetReference (REFS2:0 of ADMUX) */
+#define ANALOG_PIN_REF_VCC		0x00
+#define ANALOG_PIN_REF_AREF		0x40	// external, on PB0
+#define ANALOG_PIN_REF_1V1		0x80
+#define ANALOG_PIN_REF_MASK		0xD0
+
+/** @brief Internal channels for AnalogPin_Select (MUX3:0 of ADMUX) */
+#define ANALOG_PIN_CH_VBG		0x0C	// 1.1 V bandgap
+#define ANALOG_PIN_CH_GND		0x0D	// 0 V
+#define ANALOG_PIN_CH_TEMP		0x0F
+#define ANALOG_PIN_CH_MASK		0x0F
+
+void AnalogPin_SetReference(uint8_t ref);
+void AnalogPin_Select(uint8_t channel);
+void AnalogPin_Start(void);
+bool AnalogPin_IsBusy(void);
+uint16_t AnalogPin_GetResult(void);
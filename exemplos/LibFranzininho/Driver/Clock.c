@@ -0,0 +1,100 @@
+/*
+ * Clock.c
+ *
+ * Created: 19/10/2026 09:52:31
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/power.h>
+#include <util/delay_basic.h>
+#include "Clock.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define CLOCK_LOOP_CYCLES		4		// cycles per _delay_loop_2 iteration
+#define CLOCK_CYCLES_PER_US_Q8	((uint16_t)((F_CPU * 256ULL + 500000) / 1000000))
+
+static uint8_t Clock_Divider = CLOCK_DIV_1;
+static uint16_t Clock_LoopsPerMs = (uint16_t)(F_CPU / 1000 / CLOCK_LOOP_CYCLES);
+
+/**
+ * @brief Changes the core clock to F_CPU >> div. The Timer driver is
+ *        retuned first so its tick period stays the same; if that is not
+ *        possible the clock is left unchanged.
+ * @param div CLOCK_DIV_xxx
+ * @return false if div is invalid or the Timer tick cannot be kept
+ */
+bool Clock_SetDivider(uint8_t div)
+{
+	uint8_t sreg;
+
+	if(div >= CLOCK_DIV_MAX)
+	{
+		return false;
+	}
+
+	sreg = SREG;
+	cli();
+	if(Timer_Rescale((int8_t)div - (int8_t)Clock_Divider) == false)
+	{
+		SREG = sreg;
+		return false;
+	}
+	/* CLKPCE then the divider within 4 cycles: avr-libc does it in asm,
+	   two C stores are not guaranteed to be that close */
+	clock_prescale_set((clock_div_t)div);
+	Clock_Divider = div;
+	Clock_LoopsPerMs = (uint16_t)((F_CPU / 1000 / CLOCK_LOOP_CYCLES) >> div);
+	SREG = sreg;
+	return true;
+}
+
+/**
+ * @brief
+ * @return CLOCK_DIV_xxx
+ */
+uint8_t Clock_GetDivider(void)
+{
+	return Clock_Divider;
+}
+
+/**
+ * @brief
+ * @return current core clock in Hz
+ */
+uint32_t Clock_GetFrequency(void)
+{
+	return (uint32_t)F_CPU >> Clock_Divider;
+}
+
+/**
+ * @brief Busy wait that follows the current clock divider
+ * @param ms
+ */
+void Clock_DelayMs(uint16_t ms)
+{
+	while(ms--)
+	{
+		_delay_loop_2(Clock_LoopsPerMs);
+	}
+}
+
+/**
+ * @brief Busy wait that follows the current clock divider. The call costs
+ *        a few tens of cycles, which matters only for very short waits at
+ *        the slowest clocks.
+ * @param us
+ */
+void Clock_DelayUs(uint16_t us)
+{
+	uint32_t loops = (((uint32_t)us * CLOCK_CYCLES_PER_US_Q8) >> (8 + Clock_Divider)) / CLOCK_LOOP_CYCLES;
+
+	while(loops > 0xFFFF)
+	{
+		_delay_loop_2(0);			// 65536 iterations
+		loops -= 0x10000;
+	}
+	if(loops != 0)
+	{
+		_delay_loop_2((uint16_t)loops);
+	}
+}
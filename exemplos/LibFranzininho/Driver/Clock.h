@@ -0,0 +1,45 @@
+/*
+ * Clock.h
+ *
+ * Created: 19/10/2026 09:52:49
+ */
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Runtime system clock prescaler (CLKPR). F_CPU is the undivided
+ *        clock; the core runs at F_CPU >> divider. Use Clock_DelayMs and
+ *        Clock_DelayUs instead of _delay_ms/_delay_us in code that may run
+ *        with a divided clock, the avr-libc ones assume F_CPU.
+ *
+ *        The Timer driver tick is kept by Clock_SetDivider (see
+ *        Timer_Rescale); the change is refused when the tick would be
+ *        shorter than 256 Timer0 counts. SoftwareUart must be flushed before
+ *        and initialised again after a change.
+ *
+ *        Servo, FreqMeter, Dds and Dac compute their Timer1 settings from
+ *        F_CPU and are not rescaled: change the divider only while they
+ *        are stopped. Dds and Dac run from the PLL and keep their PWM
+ *        frequency, but their ISR gets fewer cycles.
+ */
+#define CLOCK_DIV_1			0
+#define CLOCK_DIV_2			1
+#define CLOCK_DIV_4			2
+#define CLOCK_DIV_8			3
+#define CLOCK_DIV_16		4
+#define CLOCK_DIV_32		5
+#define CLOCK_DIV_64		6
+#define CLOCK_DIV_128		7
+#define CLOCK_DIV_256		8
+#define CLOCK_DIV_MAX		9
+
+bool Clock_SetDivider(uint8_t div);
+uint8_t Clock_GetDivider(void);
+uint32_t Clock_GetFrequency(void);
+void Clock_DelayMs(uint16_t ms);
+void Clock_DelayUs(uint16_t us);
+
+#endif /* CLOCK_H_ */
@@ -0,0 +1,277 @@
+/*
+ * Dac.c
+ *
+ * Created: 19/10/2026 10:04:51
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <stddef.h>
+#include "Dac.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define DAC_CS			TIMER1_PWM_CS(DAC_PRESCALER)
+
+#if DAC_CS == 0
+#error "DAC_PRESCALER must be a power of two 1..64"
+#endif
+
+#define DAC_DITHER_BITS	2
+#define DAC_DITHER_MASK	((1 << DAC_DITHER_BITS) - 1)
+#define DAC_CHANNELS	2
+
+/** @brief */
+typedef struct
+{
+	uint16_t Value[DAC_CHANNELS];
+	uint8_t Error[DAC_CHANNELS];		// sigma-delta accumulators
+	ring_buffer_t *Stream;
+	uint8_t StreamChannel;
+	uint8_t Divider;
+	uint8_t Countdown;
+	uint8_t Underruns;
+	bool Dither;
+	bool StsInit;
+}dac_t;
+
+static volatile dac_t Dac = {0};
+
+static void Dac_Set(uint8_t channel, uint16_t value);
+
+/**
+ * @brief Sigma-delta modulator and stream sample clock. The FIFO pop is
+ *        written out here instead of calling RingBuffer_Get: any call
+ *        would make the ISR save every call-clobbered register on every
+ *        PWM period, sample or not.
+ */
+ISR (TIMER1_OVF_vect)
+{
+	ring_buffer_t *rb = Dac.Stream;
+	uint8_t tail;
+	uint16_t sample;
+	uint16_t sum;
+
+	if((rb != NULL) && (--Dac.Countdown == 0))
+	{
+		Dac.Countdown = Dac.Divider;
+		tail = rb->Tail;
+		if((uint8_t)(rb->Head - tail) < 2)
+		{
+			if(Dac.Underruns != 0xFF)
+			{
+				Dac.Underruns++;
+			}
+		}
+		else
+		{
+			sample = rb->Buffer[tail & rb->Mask];
+			sample |= (uint16_t)rb->Buffer[(uint8_t)(tail + 1) & rb->Mask] << 8;
+			rb->Tail = tail + 2;
+			if(sample > DAC_MAX)
+			{
+				sample = DAC_MAX;
+			}
+			Dac.Value[Dac.StreamChannel] = sample;
+			if(Dac.Dither == false)
+			{
+				if(Dac.StreamChannel == DAC_CHANNEL_A)
+				{
+					OCR1A = (uint8_t)(sample >> DAC_DITHER_BITS);
+				}
+				else
+				{
+					OCR1B = (uint8_t)(sample >> DAC_DITHER_BITS);
+				}
+			}
+		}
+	}
+
+	if(Dac.Dither == true)
+	{
+		sum = Dac.Value[DAC_CHANNEL_A] + Dac.Error[DAC_CHANNEL_A];
+		Dac.Error[DAC_CHANNEL_A] = sum & DAC_DITHER_MASK;
+		OCR1A = (sum > DAC_MAX) ? TIMER1_PWM_TOP : (uint8_t)(sum >> DAC_DITHER_BITS);
+
+		sum = Dac.Value[DAC_CHANNEL_B] + Dac.Error[DAC_CHANNEL_B];
+		Dac.Error[DAC_CHANNEL_B] = sum & DAC_DITHER_MASK;
+		OCR1B = (sum > DAC_MAX) ? TIMER1_PWM_TOP : (uint8_t)(sum >> DAC_DITHER_BITS);
+	}
+}
+
+/**
+ * @brief Starts the PLL clock for Timer1 and the PWM outputs at 0
+ * @param channel_a drive OC1A (PB1)
+ * @param channel_b drive OC1B (PB4)
+ * @param dither 10 bit sigma-delta, otherwise 8 bit PWM without interrupt
+ */
+void Dac_Init(bool channel_a, bool channel_b, bool dither)
+{
+	TIMSK &= ~(1 << TOIE1);
+	Dac.Value[DAC_CHANNEL_A] = 0;
+	Dac.Value[DAC_CHANNEL_B] = 0;
+	Dac.Error[DAC_CHANNEL_A] = 0;
+	Dac.Error[DAC_CHANNEL_B] = 0;
+	Dac.Stream = NULL;
+	Dac.Underruns = 0;
+	Dac.Dither = dither;
+
+	Timer1Pwm_Init(DAC_CS, 0, channel_a, channel_b);
+
+	Dac.StsInit = true;
+	if(dither == true)
+	{
+		TIFR = (1 << TOV1);
+		TIMSK |= (1 << TOIE1);
+	}
+	sei();
+}
+
+/**
+ * @brief Sets an output, takes effect on the next PWM period
+ * @param channel DAC_CHANNEL_A or DAC_CHANNEL_B
+ * @param value 0..DAC_MAX
+ */
+void Dac_Write(uint8_t channel, uint16_t value)
+{
+	uint8_t sreg;
+
+	if((Dac.StsInit == false) || (channel >= DAC_CHANNELS))
+	{
+		return;
+	}
+	sreg = SREG;
+	cli();
+	Dac_Set(channel, value);
+	SREG = sreg;
+}
+
+/**
+ * @brief Plays samples queued with Dac_StreamPut at DAC_PWM_RATE / divider.
+ *        On underrun the output holds the last sample.
+ * @param channel
+ * @param rb buffer for the samples, 2 bytes each, at least 4 bytes
+ * @param divider 1..255 PWM periods per sample
+ * @return
+ */
+bool Dac_StreamStart(uint8_t channel, ring_buffer_t *rb, uint8_t divider)
+{
+	uint8_t sreg;
+
+	if((Dac.StsInit == false) || (channel >= DAC_CHANNELS) || (rb == NULL) || (divider == 0))
+	{
+		return false;
+	}
+	sreg = SREG;
+	cli();
+	Dac.StreamChannel = channel;
+	Dac.Divider = divider;
+	Dac.Countdown = divider;
+	Dac.Underruns = 0;
+	Dac.Stream = rb;
+	TIFR = (1 << TOV1);
+	TIMSK |= (1 << TOIE1);
+	SREG = sreg;
+	return true;
+}
+
+/**
+ * @brief Stream divider for an output filtered by an RC low-pass: samples
+ *        come DAC_RC_RATIO times faster than the cutoff, as far as the
+ *        1..255 range of the divider allows. Faster updates are smoothed
+ *        away by the filter and only cost interrupts.
+ * @param cutoff_hz 1 / (2 pi R C)
+ * @return divider for Dac_StreamStart
+ */
+uint8_t Dac_RcDivider(uint16_t cutoff_hz)
+{
+	uint32_t divider;
+
+	if(cutoff_hz == 0)
+	{
+		return 0xFF;
+	}
+	divider = DAC_PWM_RATE / ((uint32_t)cutoff_hz * DAC_RC_RATIO);
+	if(divider > 0xFF)
+	{
+		return 0xFF;
+	}
+	return (divider == 0) ? 1 : (uint8_t)divider;
+}
+
+/**
+ * @brief Queues one sample, low byte first so the ISR never sees half of it
+ * @param sample 0..DAC_MAX
+ * @return false if the buffer is full or no stream is running
+ */
+bool Dac_StreamPut(uint16_t sample)
+{
+	ring_buffer_t *rb = Dac.Stream;
+
+	if((rb == NULL) || (RingBuffer_Free(rb) < sizeof(sample)))
+	{
+		return false;
+	}
+	RingBuffer_Put(rb, (uint8_t)sample);
+	RingBuffer_Put(rb, (uint8_t)(sample >> 8));
+	return true;
+}
+
+/**
+ * @brief Stops taking samples, the output keeps the last one
+ */
+void Dac_StreamStop(void)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+	Dac.Stream = NULL;
+	if(Dac.Dither == false)
+	{
+		TIMSK &= ~(1 << TOIE1);
+	}
+	SREG = sreg;
+}
+
+/**
+ * @brief
+ * @return samples that were due while the buffer was empty, saturates at 255
+ */
+uint8_t Dac_GetUnderruns(void)
+{
+	return Dac.Underruns;
+}
+
+/**
+ * @brief Stops Timer1 and releases the pins
+ */
+void Dac_Off(void)
+{
+	TIMSK &= ~(1 << TOIE1);
+	Timer1Pwm_Off();
+	Dac.Stream = NULL;
+	Dac.StsInit = false;
+}
+
+/**
+ * @brief Interrupts must be off
+ * @param channel
+ * @param value
+ */
+static void Dac_Set(uint8_t channel, uint16_t value)
+{
+	if(value > DAC_MAX)
+	{
+		value = DAC_MAX;
+	}
+	Dac.Value[channel] = value;
+	if(Dac.Dither == false)
+	{
+		if(channel == DAC_CHANNEL_A)
+		{
+			OCR1A = (uint8_t)(value >> DAC_DITHER_BITS);
+		}
+		else
+		{
+			OCR1B = (uint8_t)(value >> DAC_DITHER_BITS);
+		}
+	}
+}
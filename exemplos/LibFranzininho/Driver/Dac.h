@@ -0,0 +1,62 @@
+/*
+ * Dac.h
+ *
+ * Created: 19/10/2026 10:04:58
+ */
+#ifndef DAC_H_
+#define DAC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "../Util/RingBuffer.h"
+#include "Timer1Pwm.h"
+
+/**
+ * @brief 10 bit analog outputs on OC1A (PB1) and OC1B (PB4). Timer1 runs
+ *        from the PLL clock in 8 bit fast PWM at DAC_PWM_RATE, PCK / 256 /
+ *        DAC_PRESCALER (64.5 kHz by default at 16.5 MHz, PCK = 66 MHz).
+ *        With dithering the overflow interrupt adds the 2 low bits of each
+ *        value to an error accumulator (first order sigma-delta) and bumps
+ *        the duty cycle by one step whenever it carries, so the average
+ *        over 4 periods has 10 bit resolution. Without dithering the
+ *        outputs are plain 8 bit PWM (value / 4) and no interrupt runs.
+ *
+ * Filter the output with an RC low-pass well below the dither period
+ * (PWM frequency / 4, 16.1 kHz by default): 10 kOhm / 1 uF (16 Hz) keeps
+ * the ripple under 1 LSB of 10 bits. Dac_Write takes constant time (one
+ * atomic 16 bit store). Streams are paced by the PWM overflow: pass
+ * Dac_RcDivider(cutoff) to Dac_StreamStart to update about DAC_RC_RATIO
+ * times per filter cutoff period instead of on every PWM period.
+ *
+ * The overflow interrupt runs every 64 * DAC_PRESCALER CPU cycles (256
+ * PLL clocks, PCK = 4 * F_CPU), 256 cycles with the default prescaler. It
+ * makes no calls, the FIFO pop is inline; about 60 cycles with both
+ * channels dithered plus 40 on the periods that take a stream sample
+ * (estimated from the C, not measured), up to ~40% of the CPU.
+ * DAC_PRESCALER 8 halves the load if the 32 kHz PWM is still far enough
+ * above the filter.
+ */
+#ifndef DAC_PRESCALER
+#define DAC_PRESCALER		4		// PCK divider, power of two 1..64
+#endif
+
+#ifndef DAC_RC_RATIO
+#define DAC_RC_RATIO		8		// stream samples per RC cutoff period
+#endif
+
+#define DAC_PWM_RATE		(TIMER1_PWM_PCK / DAC_PRESCALER / 256)
+#define DAC_MAX				1023
+
+#define DAC_CHANNEL_A		0		// OC1A, PB1
+#define DAC_CHANNEL_B		1		// OC1B, PB4
+
+void Dac_Init(bool channel_a, bool channel_b, bool dither);
+void Dac_Write(uint8_t channel, uint16_t value);
+uint8_t Dac_RcDivider(uint16_t cutoff_hz);
+bool Dac_StreamStart(uint8_t channel, ring_buffer_t *rb, uint8_t divider);
+bool Dac_StreamPut(uint16_t sample);
+void Dac_StreamStop(void);
+uint8_t Dac_GetUnderruns(void);
+void Dac_Off(void);
+
+#endif /* DAC_H_ */
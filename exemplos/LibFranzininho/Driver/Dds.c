@@ -0,0 +1,287 @@
+/*
+ * Dds.c
+ *
+ * Created: 19/10/2026 09:58:51
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <stddef.h>
+#include "Dds.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+/** @brief Mixer shift so that DDS_VOICES full scale voices cannot clip */
+#if DDS_VOICES <= 1
+#define DDS_MIX_SHIFT	0
+#elif DDS_VOICES <= 2
+#define DDS_MIX_SHIFT	1
+#elif DDS_VOICES <= 4
+#define DDS_MIX_SHIFT	2
+#elif DDS_VOICES <= 8
+#define DDS_MIX_SHIFT	3
+#else
+#error "DDS_VOICES must be 1..8"
+#endif
+
+#if (DDS_OVERSAMPLE < 1) || (DDS_OVERSAMPLE > 255)
+#error "DDS_OVERSAMPLE must be 1..255"
+#endif
+
+#define DDS_CS			TIMER1_PWM_CS(1)	// PCK / 256 carrier
+#define DDS_PWM_MID		0x80
+
+/** @brief */
+typedef struct
+{
+	uint16_t Phase;
+	uint16_t Step;			// phase increment per sample
+	const int8_t *Wave;		// 256 entries in flash
+	uint8_t Attenuation;	// right shift of the samples
+	uint8_t Channel;
+	bool Active;
+}dds_voice_t;
+
+/** @brief One sine period, full scale */
+const int8_t Dds_Sine[256] PROGMEM =
+{
+	   0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+	  49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+	  90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+	 117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+	 127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+	 117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+	  90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+	  49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+	   0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+	 -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+	 -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+	-117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+	-127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+	-117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+	 -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+	 -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3
+};
+
+static volatile dds_voice_t Dds_Voices[DDS_VOICES];
+static volatile uint8_t Dds_Countdown;		// PWM overflows left to the next sample
+
+static void Dds_Mix(void);
+static uint16_t Dds_Step(uint16_t freq_hz);
+
+/**
+ * @brief Runs on every PWM overflow (64 CPU cycles), so the
+ *        common path only counts down, 27 cycles including the interrupt
+ *        response and the vector jump:
+ *
+ *   response + rjmp     6
+ *   push / in / push    5   r24 and SREG
+ *   lds / dec / brne    5
+ *   sts                 2
+ *   pop / out / pop     5
+ *   reti                4
+ *
+ *        Every DDS_OVERSAMPLE-th overflow saves the registers a C function
+ *        may clobber and calls Dds_Mix with interrupts enabled, so the
+ *        overflows that come while it mixes are still counted.
+ */
+ISR (TIMER1_OVF_vect, ISR_NAKED)
+{
+	asm volatile(
+		"push r24"						"\n\t"
+		"in   r24, __SREG__"			"\n\t"
+		"push r24"						"\n\t"
+		"lds  r24, %[count]"			"\n\t"
+		"dec  r24"						"\n\t"
+		"brne 1f"						"\n\t"
+		"ldi  r24, %[reload]"			"\n\t"
+		"sts  %[count], r24"			"\n\t"
+		"push r0"						"\n\t"
+		"push r1"						"\n\t"
+		"clr  r1"						"\n\t"
+		"push r18"						"\n\t"
+		"push r19"						"\n\t"
+		"push r20"						"\n\t"
+		"push r21"						"\n\t"
+		"push r22"						"\n\t"
+		"push r23"						"\n\t"
+		"push r25"						"\n\t"
+		"push r26"						"\n\t"
+		"push r27"						"\n\t"
+		"push r30"						"\n\t"
+		"push r31"						"\n\t"
+		"sei"							"\n\t"
+		"%~call %x[mix]"				"\n\t"
+		"cli"							"\n\t"
+		"pop  r31"						"\n\t"
+		"pop  r30"						"\n\t"
+		"pop  r27"						"\n\t"
+		"pop  r26"						"\n\t"
+		"pop  r25"						"\n\t"
+		"pop  r23"						"\n\t"
+		"pop  r22"						"\n\t"
+		"pop  r21"						"\n\t"
+		"pop  r20"						"\n\t"
+		"pop  r19"						"\n\t"
+		"pop  r18"						"\n\t"
+		"pop  r1"						"\n\t"
+		"pop  r0"						"\n\t"
+		"rjmp 2f"						"\n\t"
+		"1:"							"\n\t"
+		"sts  %[count], r24"			"\n\t"
+		"2:"							"\n\t"
+		"pop  r24"						"\n\t"
+		"out  __SREG__, r24"			"\n\t"
+		"pop  r24"						"\n\t"
+		"reti"							"\n\t"
+		:
+		: [count] "i" (&Dds_Countdown), [reload] "M" (DDS_OVERSAMPLE), [mix] "i" (Dds_Mix)
+	);
+}
+
+/**
+ * @brief Mixes the active voices into the two PWM duty cycles, once per
+ *        sample. Only called from the overflow handler.
+ */
+static void Dds_Mix(void)
+{
+	int16_t mix[2] = {0, 0};
+	volatile dds_voice_t *v = Dds_Voices;
+	uint8_t i;
+
+	for(i = 0; i < DDS_VOICES; i++, v++)
+	{
+		if(v->Active == true)
+		{
+			v->Phase += v->Step;
+			mix[v->Channel] += (int8_t)pgm_read_byte(v->Wave + (v->Phase >> 8)) >> v->Attenuation;
+		}
+	}
+	OCR1A = (uint8_t)((mix[DDS_CHANNEL_A] >> DDS_MIX_SHIFT) + DDS_PWM_MID);
+	OCR1B = (uint8_t)((mix[DDS_CHANNEL_B] >> DDS_MIX_SHIFT) + DDS_PWM_MID);
+}
+
+/**
+ * @brief Starts the PLL clock for Timer1 and the PWM outputs
+ * @param channel_a drive OC1A (PB1)
+ * @param channel_b drive OC1B (PB4)
+ */
+void Dds_Init(bool channel_a, bool channel_b)
+{
+	uint8_t i;
+
+	for(i = 0; i < DDS_VOICES; i++)
+	{
+		Dds_Voices[i].Active = false;
+	}
+
+	Dds_Countdown = DDS_OVERSAMPLE;
+	Timer1Pwm_Init(DDS_CS, DDS_PWM_MID, channel_a, channel_b);
+
+	TIFR = (1 << TOV1);
+	TIMSK |= (1 << TOIE1);
+	sei();
+}
+
+/**
+ * @brief
+ * @param voice 0..DDS_VOICES-1
+ * @param freq_hz up to DDS_SAMPLE_RATE / 2
+ * @param channel DDS_CHANNEL_A or DDS_CHANNEL_B
+ * @param attenuation 0 full scale, each step halves the amplitude
+ */
+void Dds_Play(uint8_t voice, uint16_t freq_hz, uint8_t channel, uint8_t attenuation)
+{
+	uint16_t step = Dds_Step(freq_hz);
+	uint8_t sreg;
+
+	if(voice >= DDS_VOICES)
+	{
+		return;
+	}
+	sreg = SREG;
+	cli();
+	if(Dds_Voices[voice].Active == false)
+	{
+		Dds_Voices[voice].Phase = 0;
+		if(Dds_Voices[voice].Wave == NULL)
+		{
+			Dds_Voices[voice].Wave = Dds_Sine;
+		}
+	}
+	Dds_Voices[voice].Step = step;
+	Dds_Voices[voice].Channel = (channel == DDS_CHANNEL_B) ? DDS_CHANNEL_B : DDS_CHANNEL_A;
+	Dds_Voices[voice].Attenuation = (attenuation > 7) ? 7 : attenuation;
+	Dds_Voices[voice].Active = true;
+	SREG = sreg;
+}
+
+/**
+ * @brief Changes the pitch without resetting the phase (no click)
+ * @param voice
+ * @param freq_hz
+ */
+void Dds_SetFrequency(uint8_t voice, uint16_t freq_hz)
+{
+	uint16_t step = Dds_Step(freq_hz);
+	uint8_t sreg;
+
+	if(voice >= DDS_VOICES)
+	{
+		return;
+	}
+	sreg = SREG;
+	cli();
+	Dds_Voices[voice].Step = step;
+	SREG = sreg;
+}
+
+/**
+ * @brief
+ * @param voice
+ * @param wave 256 signed samples in PROGMEM, Dds_Sine by default; NULL
+ *        is ignored, the ISR would read the vector table
+ */
+void Dds_SetWave(uint8_t voice, const int8_t *wave)
+{
+	uint8_t sreg;
+
+	if((voice >= DDS_VOICES) || (wave == NULL))
+	{
+		return;
+	}
+	sreg = SREG;
+	cli();
+	Dds_Voices[voice].Wave = wave;
+	SREG = sreg;
+}
+
+/**
+ * @brief
+ * @param voice
+ */
+void Dds_Stop(uint8_t voice)
+{
+	if(voice < DDS_VOICES)
+	{
+		Dds_Voices[voice].Active = false;
+	}
+}
+
+/**
+ * @brief Stops Timer1 and releases the PWM pins
+ */
+void Dds_Off(void)
+{
+	TIMSK &= ~(1 << TOIE1);
+	Timer1Pwm_Off();
+}
+
+/**
+ * @brief
+ * @param freq_hz
+ * @return phase increment per sample, freq * 65536 / sample rate
+ */
+static uint16_t Dds_Step(uint16_t freq_hz)
+{
+	return (uint16_t)((((uint32_t)freq_hz << 16) + (DDS_SAMPLE_RATE / 2)) / DDS_SAMPLE_RATE);
+}
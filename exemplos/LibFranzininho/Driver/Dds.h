@@ -0,0 +1,54 @@
+/*
+ * Dds.h
+ *
+ * Created: 19/10/2026 09:58:58
+ */
+#ifndef DDS_H_
+#define DDS_H_
+
+#include <avr/pgmspace.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Timer1Pwm.h"
+
+/**
+ * @brief Direct digital synthesis on Timer1. Timer1 runs from the PLL
+ *        clock (TIMER1_PWM_PCK) in fast PWM, OC1A (PB1) and OC1B (PB4) carry the two
+ *        output channels; add an RC low-pass or a speaker driver on them.
+ *        Every DDS_OVERSAMPLE-th PWM overflow is a sample: each voice
+ *        advances a 16 bit phase accumulator and reads a 256 entry wave
+ *        table from flash.
+ *
+ * The PWM carrier is PCK / 256, 258 kHz at 16.5 MHz, well above hearing
+ * and easy to filter, and the sample rate is the carrier / DDS_OVERSAMPLE,
+ * 16113 Hz by default with a frequency step of 0.25 Hz. The carrier has a
+ * fixed cost: the overflow interrupt comes every 64 CPU cycles (PCK is
+ * 4 * F_CPU) and the overflows that only count down take 27 (counted from
+ * the asm), 405 of every 1024 cycles with the default DDS_OVERSAMPLE, ~40%
+ * of the CPU. The mixing time per sample depends on the compiler and the
+ * number of voices and has not been measured; it runs with interrupts
+ * enabled and must stay below DDS_OVERSAMPLE * 64 cycles.
+ */
+#ifndef DDS_VOICES
+#define DDS_VOICES			4
+#endif
+
+#ifndef DDS_OVERSAMPLE
+#define DDS_OVERSAMPLE		16		// PWM overflows per sample, 1..255
+#endif
+
+#define DDS_SAMPLE_RATE		(TIMER1_PWM_PCK / 256 / DDS_OVERSAMPLE)
+
+#define DDS_CHANNEL_A		0		// OC1A, PB1
+#define DDS_CHANNEL_B		1		// OC1B, PB4
+
+extern const int8_t Dds_Sine[256] PROGMEM;
+
+void Dds_Init(bool channel_a, bool channel_b);
+void Dds_Play(uint8_t voice, uint16_t freq_hz, uint8_t channel, uint8_t attenuation);
+void Dds_SetFrequency(uint8_t voice, uint16_t freq_hz);
+void Dds_SetWave(uint8_t voice, const int8_t *wave);
+void Dds_Stop(uint8_t voice);
+void Dds_Off(void);
+
+#endif /* DDS_H_ */
@@ -0,0 +1,235 @@
+/*
+ * Eeprom.c
+ *
+ * Created: 19/10/2026 09:50:04
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "Eeprom.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define EEPROM_QUEUE_MASK		(EEPROM_QUEUE_SIZE - 1)
+#define EEPROM_ERASED			0xFF
+
+#if (EEPROM_QUEUE_SIZE & EEPROM_QUEUE_MASK) != 0
+#error "EEPROM_QUEUE_SIZE must be a power of two"
+#endif
+
+/** @brief */
+typedef struct
+{
+	uint16_t Addr;
+	uint8_t Data;
+}eeprom_entry_t;
+
+static volatile eeprom_entry_t Eeprom_Queue[EEPROM_QUEUE_SIZE];
+static volatile uint8_t Eeprom_Head = 0;	// written by the application only
+static volatile uint8_t Eeprom_Tail = 0;	// written by the ISR only
+
+static bool Eeprom_Program(uint16_t addr, uint8_t data);
+static bool Eeprom_FindPending(uint16_t addr, uint8_t *data);
+
+/**
+ * @brief EE_RDY fires while the EEPROM is idle and EERIE is set. Each call
+ *        starts the next pending write; bytes that already hold the value
+ *        are skipped without touching the cell.
+ */
+ISR (EE_RDY_vect)
+{
+	uint8_t tail = Eeprom_Tail;
+	uint16_t addr;
+	uint8_t data;
+
+	while(tail != Eeprom_Head)
+	{
+		addr = Eeprom_Queue[tail].Addr;
+		data = Eeprom_Queue[tail].Data;
+		tail = (tail + 1) & EEPROM_QUEUE_MASK;
+		Eeprom_Tail = tail;
+		if(Eeprom_Program(addr, data))
+		{
+			return;
+		}
+	}
+	EECR &= ~(1 << EERIE);	// queue drained
+}
+
+/**
+ * @brief Starts one atomic byte write, choosing the shortest programming
+ *        mode: erase only (0xFF) or write only (no bit goes 0 -> 1) take
+ *        1.8 ms instead of 3.4 ms for erase and write.
+ * @param addr
+ * @param data
+ * @return false if the cell already holds data and nothing was started
+ */
+static bool Eeprom_Program(uint16_t addr, uint8_t data)
+{
+	uint8_t old;
+	uint8_t mode;
+
+	EEAR = addr;
+	EECR |= (1 << EERE);
+	old = EEDR;
+
+	if(old == data)
+	{
+		return false;
+	}
+	else if(data == EEPROM_ERASED)
+	{
+		mode = (1 << EEPM0);			// erase only
+	}
+	else if((data & ~old) == 0)
+	{
+		mode = (1 << EEPM1);			// write only
+	}
+	else
+	{
+		mode = 0;						// erase and write
+	}
+
+	EECR = mode | (EECR & (1 << EERIE));
+	EEDR = data;
+	EECR |= (1 << EEMPE);
+	EECR |= (1 << EEPE);
+	return true;
+}
+
+/**
+ * @brief Looks for the newest queued value of addr. Call with interrupts off.
+ * @param addr
+ * @param data
+ * @return
+ */
+static bool Eeprom_FindPending(uint16_t addr, uint8_t *data)
+{
+	uint8_t i = Eeprom_Head;
+
+	while(i != Eeprom_Tail)
+	{
+		i = (i - 1) & EEPROM_QUEUE_MASK;
+		if(Eeprom_Queue[i].Addr == addr)
+		{
+			*data = Eeprom_Queue[i].Data;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Queues one byte write and returns at once, the write itself is
+ *        done in background by the EE_RDY interrupt.
+ * @param addr
+ * @param data
+ * @return false if the queue is full or addr is out of range
+ */
+bool Eeprom_Write(uint16_t addr, uint8_t data)
+{
+	return Eeprom_WriteBlock(addr, &data, 1);
+}
+
+/**
+ * @brief Queues len bytes. Either the whole block is queued or nothing is,
+ *        and bytes reach the EEPROM in the order they were queued.
+ * @param addr
+ * @param src
+ * @param len
+ * @return false if the queue has no room for len bytes or the block is out of range
+ */
+bool Eeprom_WriteBlock(uint16_t addr, const void *src, uint8_t len)
+{
+	const uint8_t *p = (const uint8_t *)src;
+	uint8_t head = Eeprom_Head;
+
+	if((len > Eeprom_GetFree()) || ((addr + len) > EEPROM_SIZE))
+	{
+		return false;
+	}
+
+	while(len--)
+	{
+		Eeprom_Queue[head].Addr = addr++;
+		Eeprom_Queue[head].Data = *p++;
+		head = (head + 1) & EEPROM_QUEUE_MASK;
+	}
+	Eeprom_Head = head;
+	EECR |= (1 << EERIE);
+	sei();
+	return true;
+}
+
+/**
+ * @brief Reads one byte, returning the queued value when a write to addr is
+ *        still pending. Otherwise it has to wait for the write in progress
+ *        (if any) to finish, since the EEPROM cannot be read meanwhile.
+ * @param addr
+ * @return
+ */
+uint8_t Eeprom_Read(uint16_t addr)
+{
+	uint8_t data = EEPROM_ERASED;
+	uint8_t sreg;
+
+	for(;;)
+	{
+		sreg = SREG;
+		cli();
+		if(Eeprom_FindPending(addr, &data))
+		{
+			break;
+		}
+		if(!(EECR & (1 << EEPE)))
+		{
+			EEAR = addr;
+			EECR |= (1 << EERE);
+			data = EEDR;
+			break;
+		}
+		SREG = sreg;
+	}
+	SREG = sreg;
+	return data;
+}
+
+/**
+ * @brief
+ * @param addr
+ * @param dst
+ * @param len
+ */
+void Eeprom_ReadBlock(uint16_t addr, void *dst, uint8_t len)
+{
+	uint8_t *p = (uint8_t *)dst;
+
+	while(len--)
+	{
+		*p++ = Eeprom_Read(addr++);
+	}
+}
+
+/**
+ * @brief
+ * @return number of byte writes that can still be queued
+ */
+uint8_t Eeprom_GetFree(void)
+{
+	return (Eeprom_Tail - Eeprom_Head - 1) & EEPROM_QUEUE_MASK;
+}
+
+/**
+ * @brief
+ * @return true when the queue is empty and no write is in progress
+ */
+bool Eeprom_IsIdle(void)
+{
+	return (Eeprom_Tail == Eeprom_Head) && !(EECR & (1 << EEPE));
+}
+
+/**
+ * @brief Blocks until every queued byte has been written
+ */
+void Eeprom_Flush(void)
+{
+	while(Eeprom_IsIdle() == false);
+}
@@ -0,0 +1,30 @@
+/*
+ * Eeprom.h
+ *
+ * Created: 19/10/2026 09:50:21
+ */
+#ifndef EEPROM_H_
+#define EEPROM_H_
+
+#include <avr/io.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of pending byte writes, must be a power of two
+ */
+#ifndef EEPROM_QUEUE_SIZE
+#define EEPROM_QUEUE_SIZE	16
+#endif
+
+#define EEPROM_SIZE			(E2END + 1)
+
+bool Eeprom_Write(uint16_t addr, uint8_t data);
+bool Eeprom_WriteBlock(uint16_t addr, const void *src, uint8_t len);
+uint8_t Eeprom_Read(uint16_t addr);
+void Eeprom_ReadBlock(uint16_t addr, void *dst, uint8_t len);
+uint8_t Eeprom_GetFree(void);
+bool Eeprom_IsIdle(void);
+void Eeprom_Flush(void);
+
+#endif /* EEPROM_H_ */
@@ -0,0 +1,167 @@
+/*
+ * EepromLog.c
+ *
+ * Created: 19/10/2026 09:50:47
+ */
+#include <avr/io.h>
+#include "EepromLog.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define EEPROM_LOG_EMPTY		0xFF
+#define EEPROM_LOG_SEQ_MOD		0xFF	// sequence numbers run 0..254
+
+/** @brief */
+typedef struct
+{
+	uint16_t Start;
+	uint8_t Slots;
+	uint8_t Size;
+	uint8_t Next;		// slot the next record goes to
+	uint8_t Seq;		// sequence number of the next record
+	uint8_t Count;		// valid records
+	bool StsInit;
+}eeprom_log_t;
+
+static eeprom_log_t EepromLog = {0};
+
+static uint16_t EepromLog_SlotAddr(uint8_t slot);
+static uint8_t EepromLog_NextSeq(uint8_t seq);
+
+/**
+ * @brief Sets up the log area and finds the newest record: it is the only
+ *        valid slot whose successor does not hold the following sequence
+ *        number.
+ * @param start first EEPROM address of the log area
+ * @param slots number of records kept (1..EEPROM_LOG_MAX_SLOTS)
+ * @param size bytes per record
+ * @return false if the area does not fit the EEPROM or the write queue
+ */
+bool EepromLog_Init(uint16_t start, uint8_t slots, uint8_t size)
+{
+	uint8_t i = 0;
+	uint8_t seq = 0;
+	uint8_t next = 0;
+	uint8_t newest = slots;
+
+	EepromLog.StsInit = false;
+	if((slots == 0) || (slots > EEPROM_LOG_MAX_SLOTS) || (size == 0) ||
+	   ((uint16_t)(size + 2) >= EEPROM_QUEUE_SIZE) ||
+	   ((start + (uint32_t)slots * (size + 1)) > EEPROM_SIZE))
+	{
+		return false;
+	}
+
+	EepromLog.Start = start;
+	EepromLog.Slots = slots;
+	EepromLog.Size = size;
+	EepromLog.Count = 0;
+
+	for(i = 0; i < slots; i++)
+	{
+		seq = Eeprom_Read(EepromLog_SlotAddr(i));
+		if(seq != EEPROM_LOG_EMPTY)
+		{
+			EepromLog.Count++;
+			next = Eeprom_Read(EepromLog_SlotAddr((i + 1 == slots) ? 0 : i + 1));
+			if((newest == slots) && (next != EepromLog_NextSeq(seq)))
+			{
+				newest = i;
+			}
+		}
+	}
+
+	if(newest == slots)
+	{
+		EepromLog.Next = 0;
+		EepromLog.Seq = 0;
+	}
+	else
+	{
+		EepromLog.Next = (newest + 1 == slots) ? 0 : newest + 1;
+		EepromLog.Seq = EepromLog_NextSeq(Eeprom_Read(EepromLog_SlotAddr(newest)));
+	}
+	EepromLog.StsInit = true;
+	return true;
+}
+
+/**
+ * @brief Queues a new record over the oldest one. Does not wait for the
+ *        EEPROM, the three steps are drained by the Eeprom driver in order.
+ * @param record
+ * @return false if the write queue has no room for the record
+ */
+bool EepromLog_Append(const void *record)
+{
+	uint16_t addr;
+
+	if((EepromLog.StsInit == false) || (Eeprom_GetFree() < (EepromLog.Size + 2)))
+	{
+		return false;
+	}
+
+	addr = EepromLog_SlotAddr(EepromLog.Next);
+	Eeprom_Write(addr, EEPROM_LOG_EMPTY);
+	Eeprom_WriteBlock(addr + 1, record, EepromLog.Size);
+	Eeprom_Write(addr, EepromLog.Seq);
+
+	EepromLog.Next = (EepromLog.Next + 1 == EepromLog.Slots) ? 0 : EepromLog.Next + 1;
+	EepromLog.Seq = EepromLog_NextSeq(EepromLog.Seq);
+	if(EepromLog.Count < EepromLog.Slots)
+	{
+		EepromLog.Count++;
+	}
+	return true;
+}
+
+/**
+ * @brief
+ * @param age 0 is the newest record, 1 the one before, ...
+ * @param record
+ * @return false if there is no such record
+ */
+bool EepromLog_Read(uint8_t age, void *record)
+{
+	uint16_t slot;
+
+	if((EepromLog.StsInit == false) || (age >= EepromLog.Count))
+	{
+		return false;
+	}
+
+	slot = (uint16_t)EepromLog.Next + EepromLog.Slots - 1 - age;
+	if(slot >= EepromLog.Slots)
+	{
+		slot -= EepromLog.Slots;
+	}
+	Eeprom_ReadBlock(EepromLog_SlotAddr((uint8_t)slot) + 1, record, EepromLog.Size);
+	return true;
+}
+
+/**
+ * @brief
+ * @return number of records available
+ */
+uint8_t EepromLog_GetCount(void)
+{
+	return EepromLog.Count;
+}
+
+/**
+ * @brief
+ * @param slot
+ * @return
+ */
+static uint16_t EepromLog_SlotAddr(uint8_t slot)
+{
+	return EepromLog.Start + (uint16_t)slot * (EepromLog.Size + 1);
+}
+
+/**
+ * @brief
+ * @param seq
+ * @return
+ */
+static uint8_t EepromLog_NextSeq(uint8_t seq)
+{
+	return (seq + 1 == EEPROM_LOG_SEQ_MOD) ? 0 : seq + 1;
+}
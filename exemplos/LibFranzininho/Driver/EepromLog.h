@@ -0,0 +1,29 @@
+/*
+ * EepromLog.h
+ *
+ * Created: 19/10/2026 09:50:59
+ */
+#ifndef EEPROMLOG_H_
+#define EEPROMLOG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Circular record log on top of the Eeprom write queue.
+ *
+ * The log area is split in slots of one sequence byte followed by the
+ * record. Records are appended to consecutive slots, so every cell is
+ * written once per lap and wear is spread over the whole area. The
+ * sequence byte is erased before and written after the record, so a
+ * reset in the middle of an append never yields a half written record.
+ * Size + 2 must not exceed EEPROM_QUEUE_SIZE - 1.
+ */
+#define EEPROM_LOG_MAX_SLOTS	254
+
+bool EepromLog_Init(uint16_t start, uint8_t slots, uint8_t size);
+bool EepromLog_Append(const void *record);
+bool EepromLog_Read(uint8_t age, void *record);
+uint8_t EepromLog_GetCount(void);
+
+#endif /* EEPROMLOG_H_ */
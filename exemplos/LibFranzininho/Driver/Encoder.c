@@ -0,0 +1,159 @@
+/*
+ * Encoder.c
+ *
+ * Created: 19/10/2026 09:56:01
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include "Encoder.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+/** @brief */
+typedef struct
+{
+	int16_t Position;
+	uint8_t State;		// (previous AB << 2), index base for the next edge
+	uint8_t Errors;		// transitions where both pins changed
+	int16_t WindowStart;
+	int16_t Velocity;
+	uint8_t Window;
+	uint8_t Ticks;
+}encoder_t;
+
+/**
+ * @brief Position step for each (previous AB, current AB) pair. Pairs with no
+ *        change or with both pins changed (an edge was missed) add nothing.
+ */
+static const int8_t Encoder_Step[16] PROGMEM =
+{
+	 0, -1,  1,  0,
+	 1,  0,  0, -1,
+	-1,  0,  0,  1,
+	 0,  1, -1,  0
+};
+
+/** @brief 1 where both pins changed at once */
+static const uint8_t Encoder_Invalid[16] PROGMEM =
+{
+	0, 0, 0, 1,
+	0, 0, 1, 0,
+	0, 1, 0, 0,
+	1, 0, 0, 0
+};
+
+static volatile encoder_t Encoder = {0};
+
+/**
+ * @brief
+ */
+ISR (PCINT0_vect)
+{
+	uint8_t pins = PINB;
+	uint8_t index = Encoder.State | (((pins >> ENCODER_PIN_A) & 1) << 1) | ((pins >> ENCODER_PIN_B) & 1);
+
+	Encoder.Position += (int8_t)pgm_read_byte(&Encoder_Step[index]);
+	Encoder.Errors += pgm_read_byte(&Encoder_Invalid[index]);
+	Encoder.State = (index << 2) & 0x0F;
+}
+
+/**
+ * @brief Both pins become inputs with pull-up.
+ * @param window Encoder_Tick calls per velocity measurement (1..255)
+ */
+void Encoder_Init(uint8_t window)
+{
+	uint8_t pins;
+
+	DigitalPin_Init(ENCODER_PIN_A, INPUT);
+	DigitalPin_Init(ENCODER_PIN_B, INPUT);
+	DigitalPin_Write(ENCODER_PIN_A, HIGH);
+	DigitalPin_Write(ENCODER_PIN_B, HIGH);
+
+	pins = PINB;
+	Encoder.State = ((((pins >> ENCODER_PIN_A) & 1) << 1) | ((pins >> ENCODER_PIN_B) & 1)) << 2;
+	Encoder.Position = 0;
+	Encoder.Errors = 0;
+	Encoder.WindowStart = 0;
+	Encoder.Velocity = 0;
+	Encoder.Window = (window == 0) ? 1 : window;
+	Encoder.Ticks = 0;
+
+	PCMSK |= (1 << ENCODER_PIN_A) | (1 << ENCODER_PIN_B);
+	GIFR = (1 << PCIF);
+	GIMSK |= (1 << PCIE);
+	sei();
+}
+
+/**
+ * @brief
+ * @return counts, four per detent on most encoders
+ */
+int16_t Encoder_GetPosition(void)
+{
+	int16_t position;
+	uint8_t sreg = SREG;
+
+	cli();
+	position = Encoder.Position;
+	SREG = sreg;
+	return position;
+}
+
+/**
+ * @brief
+ * @param position
+ */
+void Encoder_SetPosition(int16_t position)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+	Encoder.WindowStart += position - Encoder.Position;
+	Encoder.Position = position;
+	SREG = sreg;
+}
+
+/**
+ * @brief
+ * @return counts in the last complete window of Encoder_Tick calls
+ */
+int16_t Encoder_GetVelocity(void)
+{
+	int16_t velocity;
+	uint8_t sreg = SREG;
+
+	cli();
+	velocity = Encoder.Velocity;
+	SREG = sreg;
+	return velocity;
+}
+
+/**
+ * @brief
+ * @return missed edges seen so far (wraps at 256)
+ */
+uint8_t Encoder_GetErrors(void)
+{
+	return Encoder.Errors;
+}
+
+/**
+ * @brief Time base for the velocity estimate: GetVelocity returns the
+ *        counts of the last 'window' calls.
+ */
+void Encoder_Tick(void)
+{
+	int16_t position;
+	uint8_t sreg = SREG;
+
+	if(++Encoder.Ticks >= Encoder.Window)
+	{
+		Encoder.Ticks = 0;
+		cli();
+		position = Encoder.Position;
+		Encoder.Velocity = position - Encoder.WindowStart;
+		Encoder.WindowStart = position;
+		SREG = sreg;
+	}
+}
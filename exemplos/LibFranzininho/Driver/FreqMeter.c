@@ -0,0 +1,334 @@
+/*
+ * FreqMeter.c
+ *
+ * Created: 19/10/2026 09:57:05
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "FreqMeter.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define FREQ_METER_GATE_CYCLES	2000UL	// Timer1 CK/16, 125 counts
+#define FREQ_METER_GATE_TOP		124
+#define FREQ_METER_GATE_CS		((1 << CS12) | (1 << CS10))		// CK/16
+#define FREQ_METER_GATES_PER_S	(F_CPU / FREQ_METER_GATE_CYCLES)
+#define FREQ_METER_STAMP_CS		((1 << CS12))					// CK/8
+#define FREQ_METER_TICKS_2MS	(F_CPU / 4000)					// CK/8 ticks in 2 ms
+
+#if (F_CPU % FREQ_METER_GATE_CYCLES) != 0
+#error "FreqMeter needs F_CPU to be a multiple of 2 kHz"
+#endif
+
+/** @brief */
+enum
+{
+	FREQ_METER_IDLE = 0,
+	FREQ_METER_FREQUENCY,
+	FREQ_METER_PULSE
+};
+
+/** @brief */
+typedef struct
+{
+	uint8_t Mode;
+	bool Ready;
+	uint16_t Gates;			// gate intervals left
+	uint16_t GateTotal;
+	uint32_t Overflows;		// Timer0 overflows or Timer1 overflows
+	uint32_t Edges;
+	uint8_t Mask;
+	uint8_t Level;
+	uint8_t Seen;			// edges seen since start, saturates at 3
+	uint32_t LastRise;
+	uint32_t Period;		// Timer1 ticks
+	uint32_t Width;			// Timer1 ticks
+	bool Borrowed;			// Timer0 taken from the Timer driver
+	uint8_t SavedTccr0b;
+	uint8_t SavedToie0;
+	void (*SavedCallback)(void);
+}freq_meter_t;
+
+static volatile freq_meter_t FreqMeter = {0};
+
+static void FreqMeter_Overflow(void);
+static void FreqMeter_ReturnTimer0(void);
+static uint32_t FreqMeter_TicksToUs(uint32_t ticks);
+static uint32_t FreqMeter_Timestamp(void);
+
+/**
+ * @brief Frequency mode: counts gate intervals and closes the gate.
+ */
+ISR (TIMER1_COMPA_vect)
+{
+	uint32_t overflows;
+
+	if(--FreqMeter.Gates == 0)
+	{
+		TCCR0B = 0x00;						// freeze the edge counter
+		TCCR1 = 0x00;
+		TIMSK &= ~(1 << OCIE1A);
+		overflows = FreqMeter.Overflows;
+		if(TIFR & (1 << TOV0))
+		{
+			TIFR = (1 << TOV0);
+			overflows++;
+		}
+		FreqMeter.Edges = (overflows << 8) | TCNT0;
+		FreqMeter.Ready = true;
+		FreqMeter.Mode = FREQ_METER_IDLE;
+		FreqMeter_ReturnTimer0();
+	}
+}
+
+/**
+ * @brief Pulse mode: extends Timer1 timestamps to 32 bits.
+ */
+ISR (TIMER1_OVF_vect)
+{
+	FreqMeter.Overflows++;
+}
+
+/**
+ * @brief Pulse mode: timestamps every edge of the selected pin.
+ */
+ISR (PCINT0_vect)
+{
+	uint32_t now = FreqMeter_Timestamp();
+	uint8_t level = PINB & FreqMeter.Mask;
+
+	if(level == FreqMeter.Level)
+	{
+		return;								// another pin changed
+	}
+	FreqMeter.Level = level;
+
+	if(level != 0)
+	{
+		FreqMeter.Period = now - FreqMeter.LastRise;
+		FreqMeter.LastRise = now;
+	}
+	else
+	{
+		FreqMeter.Width = now - FreqMeter.LastRise;
+	}
+
+	/* a rise, a fall and a rise give the first full period */
+	if((FreqMeter.Seen < 3) && ((level != 0) || (FreqMeter.Seen != 0)))
+	{
+		if(++FreqMeter.Seen == 3)
+		{
+			FreqMeter.Ready = true;
+		}
+	}
+}
+
+/**
+ * @brief Starts a frequency measurement on T0 (PB2), result available
+ *        when FreqMeter_IsReady() returns true.
+ * @param gate_ms gate time, up to FREQ_METER_MAX_GATE_MS; longer gives
+ *        more resolution (1 Hz at 1000 ms)
+ */
+void FreqMeter_StartFrequency(uint16_t gate_ms)
+{
+	uint32_t gates;
+
+	FreqMeter_Stop();
+	if(gate_ms > FREQ_METER_MAX_GATE_MS)
+	{
+		gate_ms = FREQ_METER_MAX_GATE_MS;
+	}
+	gates = ((uint32_t)gate_ms * FREQ_METER_GATES_PER_S + 500) / 1000;
+	FreqMeter.GateTotal = (gates == 0) ? 1 : (uint16_t)gates;
+	FreqMeter.Gates = FreqMeter.GateTotal;
+	FreqMeter.Overflows = 0;
+	FreqMeter.Mode = FREQ_METER_FREQUENCY;
+
+	DigitalPin_Init(PB2, INPUT);
+	FreqMeter.SavedCallback = Timer_GetCallback();
+	FreqMeter.SavedTccr0b = TCCR0B;
+	FreqMeter.SavedToie0 = TIMSK & (1 << TOIE0);
+	FreqMeter.Borrowed = true;
+	Timer_SetCallback(FreqMeter_Overflow);
+	Timer_Init(0);							// Timer0 stopped, overflow interrupt on
+
+	OCR1C = FREQ_METER_GATE_TOP;
+	OCR1A = FREQ_METER_GATE_TOP;
+	TCNT1 = 0;
+	TIFR = (1 << OCF1A);
+	TIMSK |= (1 << OCIE1A);
+
+	cli();
+	TCNT0 = 0;
+	TCCR0B = TIMER_EXTERNAL_RISING;			// gate opens
+	TCCR1 = (1 << CTC1) | FREQ_METER_GATE_CS;
+	sei();
+}
+
+/**
+ * @brief Starts timestamping edges on pin, results available when
+ *        FreqMeter_IsReady() returns true and updated on every period.
+ * @param pin
+ */
+void FreqMeter_StartPulse(uint8_t pin)
+{
+	FreqMeter_Stop();
+	FreqMeter.Mask = (1 << pin);
+	FreqMeter.Overflows = 0;
+	FreqMeter.Seen = 0;
+	FreqMeter.LastRise = 0;
+	FreqMeter.Mode = FREQ_METER_PULSE;
+
+	DigitalPin_Init(pin, INPUT);
+	FreqMeter.Level = PINB & FreqMeter.Mask;
+
+	TCNT1 = 0;
+	OCR1C = 0xFF;
+	TIFR = (1 << TOV1);
+	TIMSK |= (1 << TOIE1);
+	TCCR1 = FREQ_METER_STAMP_CS;
+
+	PCMSK |= FreqMeter.Mask;
+	GIFR = (1 << PCIF);
+	GIMSK |= (1 << PCIE);
+	sei();
+}
+
+/**
+ * @brief
+ */
+void FreqMeter_Stop(void)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+	if(FreqMeter.Mode == FREQ_METER_FREQUENCY)
+	{
+		TCCR0B = 0x00;
+		FreqMeter_ReturnTimer0();
+	}
+	else if(FreqMeter.Mode == FREQ_METER_PULSE)
+	{
+		PCMSK &= ~FreqMeter.Mask;
+		if(PCMSK == 0)
+		{
+			GIMSK &= ~(1 << PCIE);
+		}
+	}
+	TCCR1 = 0x00;
+	TIMSK &= ~((1 << OCIE1A) | (1 << TOIE1));
+	FreqMeter.Mode = FREQ_METER_IDLE;
+	FreqMeter.Ready = false;
+	SREG = sreg;
+}
+
+/**
+ * @brief
+ * @return
+ */
+bool FreqMeter_IsReady(void)
+{
+	return FreqMeter.Ready;
+}
+
+/**
+ * @brief f = edges * gates_per_second / gates, split so that no product
+ *        overflows 32 bits.
+ * @return Hz
+ */
+uint32_t FreqMeter_GetFrequency(void)
+{
+	uint32_t edges;
+	uint16_t gates;
+
+	if((FreqMeter.Ready == false) || (FreqMeter.Mode == FREQ_METER_PULSE))
+	{
+		return 0;
+	}
+	edges = FreqMeter.Edges;
+	gates = FreqMeter.GateTotal;
+	return (edges / gates) * FREQ_METER_GATES_PER_S + ((edges % gates) * FREQ_METER_GATES_PER_S) / gates;
+}
+
+/**
+ * @brief
+ * @return time between the last two rising edges in us
+ */
+uint32_t FreqMeter_GetPeriod(void)
+{
+	uint32_t ticks;
+	uint8_t sreg = SREG;
+
+	cli();
+	ticks = FreqMeter.Period;
+	SREG = sreg;
+	return FreqMeter_TicksToUs(ticks);
+}
+
+/**
+ * @brief
+ * @return time the pin stayed high in the last pulse, in us
+ */
+uint32_t FreqMeter_GetPulseWidth(void)
+{
+	uint32_t ticks;
+	uint8_t sreg = SREG;
+
+	cli();
+	ticks = FreqMeter.Width;
+	SREG = sreg;
+	return FreqMeter_TicksToUs(ticks);
+}
+
+/**
+ * @brief Timer driver callback, one call every 256 input edges
+ */
+static void FreqMeter_Overflow(void)
+{
+	FreqMeter.Overflows++;
+}
+
+/**
+ * @brief Gives Timer0 back to the Timer driver as it was before
+ *        FreqMeter_StartFrequency, call with interrupts disabled.
+ *        The edge count is lost, TCNT0 restarts from 0.
+ */
+static void FreqMeter_ReturnTimer0(void)
+{
+	if(FreqMeter.Borrowed == false)
+	{
+		return;
+	}
+	FreqMeter.Borrowed = false;
+	Timer_SetCallback(FreqMeter.SavedCallback);
+	TCNT0 = 0;
+	TIFR = (1 << TOV0);
+	TIMSK = (TIMSK & ~(1 << TOIE0)) | FreqMeter.SavedToie0;
+	TCCR0B = FreqMeter.SavedTccr0b;
+}
+
+/**
+ * @brief
+ * @param ticks Timer1 CK/8 ticks
+ * @return
+ */
+static uint32_t FreqMeter_TicksToUs(uint32_t ticks)
+{
+	return (ticks / FREQ_METER_TICKS_2MS) * 2000 + ((ticks % FREQ_METER_TICKS_2MS) * 2000) / FREQ_METER_TICKS_2MS;
+}
+
+/**
+ * @brief 32 bit Timer1 time, call with interrupts disabled. An overflow
+ *        that is pending but not yet counted is added by hand.
+ * @return
+ */
+static uint32_t FreqMeter_Timestamp(void)
+{
+	uint8_t count = TCNT1;
+	uint32_t overflows = FreqMeter.Overflows;
+
+	if((TIFR & (1 << TOV1)) && (count < 0x80))
+	{
+		overflows++;
+	}
+	return (overflows << 8) | count;
+}
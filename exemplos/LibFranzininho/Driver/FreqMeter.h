@@ -0,0 +1,41 @@
+/*
+ * FreqMeter.h
+ *
+ * Created: 19/10/2026 09:57:20
+ */
+#ifndef FREQMETER_H_
+#define FREQMETER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Frequency, period and pulse width measurement.
+ *
+ * Frequency: Timer0 counts rising edges on T0 (PB2) in hardware, the
+ * Timer driver callback only runs every 256 edges to extend the count to
+ * 32 bits, and Timer1 opens the gate. Inputs up to ~F_CPU/2.5 (6.6 MHz)
+ * can be measured with any gate time (53M edges at 7.9 s). Timer0 and its
+ * callback are borrowed while the gate is open and handed back, with the
+ * previous prescaler, when it closes or on FreqMeter_Stop. The gate and
+ * the Timer driver tick assume CLOCK_DIV_1.
+ *
+ * Period / pulse width: Timer1 runs free at F_CPU/8 (0.48 us at 16.5 MHz)
+ * extended to 32 bits by its overflow interrupt, and every edge on the
+ * selected pin is timestamped from the pin change interrupt. Periods up to
+ * ~34 minutes can be measured; a pin that stops toggling keeps reporting
+ * the last period.
+ *
+ * Both modes use Timer1, only one can run at a time.
+ */
+#define FREQ_METER_MAX_GATE_MS	7900
+
+void FreqMeter_StartFrequency(uint16_t gate_ms);
+void FreqMeter_StartPulse(uint8_t pin);
+void FreqMeter_Stop(void);
+bool FreqMeter_IsReady(void);
+uint32_t FreqMeter_GetFrequency(void);
+uint32_t FreqMeter_GetPeriod(void);
+uint32_t FreqMeter_GetPulseWidth(void);
+
+#endif /* FREQMETER_H_ */
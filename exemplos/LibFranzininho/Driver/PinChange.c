@@ -0,0 +1,42 @@
+/*
+ * PinChange.c
+ *
+ * Created: 19/10/2026 09:55:38
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "PinChange.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+/**
+ * @brief
+ */
+ISR (PCINT0_vect)
+{
+	EventQueue_Post(EVENT_PIN_CHANGE, PINB);
+}
+
+/**
+ * @brief
+ * @param pin
+ */
+void PinChange_EnableEvent(uint8_t pin)
+{
+	PCMSK |= (1 << pin);
+	GIFR = (1 << PCIF);		// drop a stale flag
+	GIMSK |= (1 << PCIE);
+	sei();
+}
+
+/**
+ * @brief
+ * @param pin
+ */
+void PinChange_DisableEvent(uint8_t pin)
+{
+	PCMSK &= ~(1 << pin);
+	if(PCMSK == 0)
+	{
+		GIMSK &= ~(1 << PCIE);
+	}
+}
@@ -0,0 +1,21 @@
+/*
+ * PinChange.h
+ *
+ * Created: 19/10/2026 09:55:44
+ */
+#ifndef PINCHANGE_H_
+#define PINCHANGE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Pin change interrupt on PB0..PB5. Every change on an enabled pin
+ *        posts EVENT_PIN_CHANGE with the PINB snapshot taken in the ISR,
+ *        so the main loop sees the pin levels of that moment even if they
+ *        have changed again since. Bounces post one event each.
+ */
+void PinChange_EnableEvent(uint8_t pin);
+void PinChange_DisableEvent(uint8_t pin);
+
+#endif /* PINCHANGE_H_ */
@@ -0,0 +1,311 @@
+/*
+ * Servo.c
+ *
+ * Created: 19/10/2026 10:00:52
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "Servo.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define SERVO_FAST_CS		((1 << CS12) | (1 << CS10))				// CK/16
+#define SERVO_SLOW_CS		((1 << CS13) | (1 << CS12))				// CK/2048
+#define SERVO_SLOW_RATIO	128										// 2048 / 16
+#define SERVO_US_TO_TICKS(us)	((uint16_t)(((uint32_t)(us) * (F_CPU / 1000UL) + 8000UL) / 16000UL))
+#define SERVO_FRAME_TICKS	SERVO_US_TO_TICKS(SERVO_FRAME_US)
+#define SERVO_MIN_TICKS		12		// shortest delay worth leaving the ISR for
+#define SERVO_STEP_TICKS	128		// chunk used to wait for long delays
+#define SERVO_EVENTS		(2 * SERVO_CHANNELS)
+
+#if SERVO_CHANNELS > 6
+#error "SERVO_CHANNELS must be 6 or less"
+#endif
+
+/** @brief */
+typedef struct
+{
+	uint16_t Ticks;			// delay from the previous entry
+	uint8_t Set;
+	uint8_t Clear;
+}servo_event_t;
+
+/** @brief */
+typedef struct
+{
+	servo_event_t *Active;	// table used by the ISR
+	servo_event_t *Shadow;	// table built by Servo_Write
+	uint8_t ActiveCount;
+	uint8_t ShadowCount;
+	uint16_t ActiveTicks;	// duration of the pulse part of the frame
+	uint16_t ShadowTicks;
+	volatile bool Pending;	// Shadow ready to be swapped in
+	uint8_t Index;
+	uint16_t Wait;
+	bool Gap;
+	uint8_t Mask[SERVO_CHANNELS];
+	uint16_t Width[SERVO_CHANNELS];		// ticks
+}servo_t;
+
+static servo_event_t Servo_Table[2][SERVO_EVENTS];
+static servo_t Servo = {0};
+
+static void Servo_Build(void);
+static bool Servo_Schedule(uint8_t base);
+
+/**
+ * @brief Applies the table entry that is due, then programs the next
+ *        compare. Long delays are waited for in SERVO_STEP_TICKS chunks.
+ *        A compare time that has already passed when it is written is
+ *        handled here instead of waiting for the counter to wrap.
+ */
+ISR (TIMER1_COMPA_vect)
+{
+	servo_event_t *tmp;
+	uint8_t base = OCR1A;
+
+	if(Servo.Gap == true)
+	{
+		/* end of the frame: swap in a new table and restart fast */
+		if(Servo.Pending == true)
+		{
+			tmp = Servo.Active;
+			Servo.Active = Servo.Shadow;
+			Servo.Shadow = tmp;
+			Servo.ActiveCount = Servo.ShadowCount;
+			Servo.ActiveTicks = Servo.ShadowTicks;
+			Servo.Pending = false;
+		}
+		if(Servo.ActiveCount == 0)
+		{
+			OCR1A = TCNT1 + (uint8_t)(SERVO_FRAME_TICKS / SERVO_SLOW_RATIO);
+			return;						// nothing attached, idle frame
+		}
+		Servo.Gap = false;
+		Servo.Index = 0;
+		TCCR1 = SERVO_FAST_CS;
+		GTCCR |= (1 << PSR1);
+		TCNT1 = 0;
+		OCR1A = SERVO_MIN_TICKS;
+		return;
+	}
+
+	for(;;)
+	{
+		if(Servo.Wait == 0)
+		{
+			PORTB = (PORTB | Servo.Active[Servo.Index].Set) & ~Servo.Active[Servo.Index].Clear;
+			if(++Servo.Index >= Servo.ActiveCount)
+			{
+				/* rest of the frame on the slow clock */
+				Servo.Gap = true;
+				TCCR1 = SERVO_SLOW_CS;
+				GTCCR |= (1 << PSR1);
+				OCR1A = TCNT1 + (uint8_t)((SERVO_FRAME_TICKS - Servo.ActiveTicks) / SERVO_SLOW_RATIO);
+				return;
+			}
+			Servo.Wait = Servo.Active[Servo.Index].Ticks;
+			if(Servo.Wait < SERVO_MIN_TICKS)
+			{
+				/* next edge too close for another interrupt, wait here */
+				base += (uint8_t)Servo.Wait;
+				Servo.Wait = 0;
+				while((int8_t)(TCNT1 - base) < 0);
+				continue;
+			}
+		}
+		if(Servo_Schedule(base) == true)
+		{
+			return;
+		}
+		/* this ISR started late and the compare time is gone: take the
+		   step now, from its nominal time so later edges are not shifted */
+		base = OCR1A;
+		TIFR = (1 << OCF1A);
+	}
+}
+
+/**
+ * @brief Timer1 runs free, all channels start detached.
+ */
+void Servo_Init(void)
+{
+	uint8_t i;
+
+	TIMSK &= ~(1 << OCIE1A);
+	for(i = 0; i < SERVO_CHANNELS; i++)
+	{
+		Servo.Mask[i] = 0;
+		Servo.Width[i] = SERVO_US_TO_TICKS(SERVO_CENTER_US);
+	}
+	Servo.Active = Servo_Table[0];
+	Servo.Shadow = Servo_Table[1];
+	Servo.ActiveCount = 0;
+	Servo.Pending = false;
+	Servo.Wait = 0;
+	Servo.Gap = true;
+
+	TCCR1 = SERVO_SLOW_CS;
+	TCNT1 = 0;
+	OCR1A = 1;
+	TIFR = (1 << OCF1A);
+	TIMSK |= (1 << OCIE1A);
+	sei();
+}
+
+/**
+ * @brief
+ * @param channel 0..SERVO_CHANNELS-1, sets the pulse slot
+ * @param pin
+ * @return false if channel is out of range
+ */
+bool Servo_Attach(uint8_t channel, uint8_t pin)
+{
+	if(channel >= SERVO_CHANNELS)
+	{
+		return false;
+	}
+	DigitalPin_Write(pin, LOW);
+	DigitalPin_Init(pin, OUTPUT);
+	Servo.Mask[channel] = (1 << pin);
+	Servo_Build();
+	return true;
+}
+
+/**
+ * @brief The pin stays low from the next frame on
+ * @param channel
+ */
+void Servo_Detach(uint8_t channel)
+{
+	if(channel < SERVO_CHANNELS)
+	{
+		Servo.Mask[channel] = 0;
+		Servo_Build();
+	}
+}
+
+/**
+ * @brief Takes effect at the next frame
+ * @param channel
+ * @param us pulse width, clamped to SERVO_MIN_US..SERVO_MAX_US
+ */
+void Servo_Write(uint8_t channel, uint16_t us)
+{
+	if(channel >= SERVO_CHANNELS)
+	{
+		return;
+	}
+	if(us < SERVO_MIN_US)
+	{
+		us = SERVO_MIN_US;
+	}
+	else if(us > SERVO_MAX_US)
+	{
+		us = SERVO_MAX_US;
+	}
+	Servo.Width[channel] = SERVO_US_TO_TICKS(us);
+	Servo_Build();
+}
+
+/**
+ * @brief Sorts the edges of all attached channels into the shadow table
+ *        (insertion sort, at most 12 edges) and hands it to the ISR.
+ */
+static void Servo_Build(void)
+{
+	uint16_t time[SERVO_EVENTS];
+	uint8_t set[SERVO_EVENTS];
+	uint8_t clear[SERVO_EVENTS];
+	uint16_t t;
+	uint16_t prev = 0;
+	uint8_t n = 0;
+	uint8_t i;
+	uint8_t j;
+	uint8_t k;
+	uint8_t sreg;
+
+	/* the ISR must not swap while the shadow table is rewritten */
+	sreg = SREG;
+	cli();
+	Servo.Pending = false;
+	SREG = sreg;
+
+	for(i = 0; i < SERVO_CHANNELS; i++)
+	{
+		if(Servo.Mask[i] == 0)
+		{
+			continue;
+		}
+		for(j = 0; j < 2; j++)
+		{
+			t = (uint16_t)i * SERVO_US_TO_TICKS(SERVO_STAGGER_US) + ((j == 0) ? 0 : Servo.Width[i]);
+
+			/* edges at the same time share one entry */
+			for(k = 0; (k < n) && (time[k] != t); k++);
+			if(k == n)
+			{
+				for(; (k > 0) && (time[k - 1] > t); k--)
+				{
+					time[k] = time[k - 1];
+					set[k] = set[k - 1];
+					clear[k] = clear[k - 1];
+				}
+				time[k] = t;
+				set[k] = 0;
+				clear[k] = 0;
+				n++;
+			}
+			if(j == 0)
+			{
+				set[k] |= Servo.Mask[i];
+			}
+			else
+			{
+				clear[k] |= Servo.Mask[i];
+			}
+		}
+	}
+
+	prev = (n != 0) ? time[0] : 0;		// the first entry starts the frame
+	for(i = 0; i < n; i++)
+	{
+		Servo.Shadow[i].Ticks = time[i] - prev;
+		Servo.Shadow[i].Set = set[i];
+		Servo.Shadow[i].Clear = clear[i];
+		prev = time[i];
+	}
+
+	/* cli() is a compiler barrier: the table stores above are done
+	 * before the ISR can see Pending */
+	sreg = SREG;
+	cli();
+	Servo.ShadowCount = n;
+	Servo.ShadowTicks = prev - ((n != 0) ? time[0] : 0) + SERVO_MIN_TICKS;
+	Servo.Pending = true;
+	SREG = sreg;
+}
+
+/**
+ * @brief Moves the compare towards the next entry, at most SERVO_STEP_TICKS
+ *        at a time so the 8 bit compare never wraps past it.
+ * @param base time of the edge just applied
+ * @return false if TCNT1 has already reached the new compare value: the
+ *         match is lost and would only come 256 ticks later
+ */
+static bool Servo_Schedule(uint8_t base)
+{
+	uint8_t delay;
+
+	if(Servo.Wait > (SERVO_STEP_TICKS + SERVO_MIN_TICKS))
+	{
+		delay = SERVO_STEP_TICKS;
+		Servo.Wait -= SERVO_STEP_TICKS;
+	}
+	else
+	{
+		delay = (uint8_t)Servo.Wait;
+		Servo.Wait = 0;
+	}
+	OCR1A = base + delay;
+	return (uint8_t)(TCNT1 - base) < delay;
+}
@@ -0,0 +1,54 @@
+/*
+ * Servo.h
+ *
+ * Created: 19/10/2026 10:01:03
+ */
+#ifndef SERVO_H_
+#define SERVO_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Up to six hobby servos on PB pins from Timer1 alone.
+ *
+ * Channel n starts its pulse SERVO_STAGGER_US after channel n-1, so the
+ * rising edges never coincide. All rising and falling edges of a frame are
+ * sorted once, when a width changes, into a table of (delay, pins to set,
+ * pins to clear); the compare A ISR only applies the next entry and adds
+ * its delay to OCR1A. Timer1 runs at F_CPU/16 (0.97 us at 16.5 MHz) during
+ * the pulses and at F_CPU/2048 for the rest of the 20 ms frame. The 8 bit
+ * compare only reaches 256 ticks ahead, so besides one interrupt per edge
+ * there is one every 128 ticks (124 us) while the next edge is further
+ * away: a single 2 ms pulse takes 19 interrupts per frame, six channels at
+ * 2.5 ms take 32. Edges closer than SERVO_MIN_TICKS are handled in
+ * the same interrupt by waiting on TCNT1.
+ *
+ * Other interrupts (Timer0 tick, UART) delay this ISR, and so an edge, by
+ * the longest of their run times plus the few us this ISR needs to reach
+ * the pin write. Every compare written is checked against TCNT1: if the
+ * delay already carried the counter past it, the edge (or the 128 tick
+ * step) is taken at once instead of after a 256 tick (250 us) wrap, and
+ * the following edges keep their nominal times, so only the delayed pulse
+ * is off. This holds while no other ISR blocks for more than about 110
+ * ticks (~110 us, 256 minus the longest final step of 140 ticks).
+ */
+#ifndef SERVO_CHANNELS
+#define SERVO_CHANNELS		6
+#endif
+
+#ifndef SERVO_STAGGER_US
+#define SERVO_STAGGER_US	250
+#endif
+
+#define SERVO_FRAME_US		20000
+#define SERVO_MIN_US		500
+#define SERVO_MAX_US		2500
+#define SERVO_CENTER_US		1500
+
+void Servo_Init(void);
+bool Servo_Attach(uint8_t channel, uint8_t pin);
+void Servo_Detach(uint8_t channel);
+void Servo_Write(uint8_t channel, uint16_t us);
+
+#endif /* SERVO_H_ */
@@ -0,0 +1,265 @@
+/*
+ * SoftwareUart.c
+ *
+ * Created: 19/10/2026 09:48:52
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <stddef.h>
+#include "SoftwareUart.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define SOFTWARE_UART_BUFFER_MASK	(SOFTWARE_UART_BUFFER_SIZE - 1)
+#define SOFTWARE_UART_FRAME_BITS	10		// start + 8 data + stop
+#define SOFTWARE_UART_MIN_CYCLES	80		// ISR cost plus margin, per bit
+#define SOFTWARE_UART_MAX_ERROR		50		// 1/50 = 2% baud rate error
+#define SOFTWARE_UART_IDLE_FRAME	0x03	// one mark bit, leaves Frame != 0
+#define SOFTWARE_UART_TIMER_CS		0x07	// CS02:0 bits of TCCR0B
+
+#if (SOFTWARE_UART_BUFFER_SIZE & SOFTWARE_UART_BUFFER_MASK) != 0
+#error "SOFTWARE_UART_BUFFER_SIZE must be a power of two"
+#endif
+
+/** @brief */
+typedef struct
+{
+	uint8_t Mask;
+	uint8_t BitTicks;
+	uint16_t Frame;
+	uint8_t Bits;
+	bool StsInit;
+}software_uart_t;
+
+/** @brief Timer0 clock divisor for each CS0 value (TIMER_PRESCALER_xxx) */
+static const uint16_t SoftwareUart_Prescaler[TIMER_PRESCALER_MAX] = {0, 1, 8, 64, 256, 1024};
+
+static volatile software_uart_t SoftwareUart = {0};
+static volatile uint8_t SoftwareUart_Buffer[SOFTWARE_UART_BUFFER_SIZE];
+static volatile uint8_t SoftwareUart_Head = 0;	// written by the application only
+static volatile uint8_t SoftwareUart_Tail = 0;	// written by the ISR only
+
+/**
+ * @brief Shifts one bit out on every Timer0 compare A match. OCR0A is moved
+ *        forward by one bit time, so the timer keeps free running and the
+ *        overflow interrupt used by the Timer driver is not disturbed.
+ *        The pin is written first so every edge has the same latency.
+ */
+ISR (TIMER0_COMPA_vect)
+{
+	uint8_t tail;
+
+	if(SoftwareUart.Frame & 1)
+	{
+		PORTB |= SoftwareUart.Mask;
+	}
+	else
+	{
+		PORTB &= ~SoftwareUart.Mask;
+	}
+
+	OCR0A += SoftwareUart.BitTicks;
+	SoftwareUart.Frame >>= 1;
+
+	if(--SoftwareUart.Bits == 0)
+	{
+		tail = SoftwareUart_Tail;
+		if(tail == SoftwareUart_Head)
+		{
+			if(SoftwareUart.Frame == 0)
+			{
+				/* stop bit just started: hold the line one more bit time so
+				   IsIdle() only reports true once it is really on the wire */
+				SoftwareUart.Frame = SOFTWARE_UART_IDLE_FRAME;
+				SoftwareUart.Bits = 1;
+			}
+			else
+			{
+				TIMSK &= ~(1 << OCIE0A);	// nothing left, go idle
+			}
+		}
+		else
+		{
+			SoftwareUart.Frame = ((uint16_t)SoftwareUart_Buffer[tail] << 1) | (1 << (SOFTWARE_UART_FRAME_BITS - 1));
+			SoftwareUart.Bits = SOFTWARE_UART_FRAME_BITS;
+			SoftwareUart_Tail = (tail + 1) & SOFTWARE_UART_BUFFER_MASK;
+		}
+	}
+}
+
+/**
+ * @brief Configures a PB pin as serial output (8N1, transmit only). If Timer0
+ *        is already running (Timer_Init) its prescaler is kept, otherwise the
+ *        finest prescaler that fits one bit time in 8 bits is selected.
+ *        Call it after Timer_Init, which resets the Timer0 prescaler,
+ *        and again after Clock_SetDivider.
+ * @param pin
+ * @param baud
+ * @return false if the baud rate cannot be generated from Timer0 within 2%
+ */
+bool SoftwareUart_Init(uint8_t pin, uint32_t baud)
+{
+	uint8_t cs = TCCR0B & SOFTWARE_UART_TIMER_CS;
+	uint32_t ticks = 0;
+	uint32_t wanted = 0;
+	uint32_t error = 0;
+
+	SoftwareUart.StsInit = false;
+
+	if(cs == 0)
+	{
+		for(cs = TIMER_NO_PRESCALER; cs < TIMER_PRESCALER_MAX; cs++)
+		{
+			if((Clock_GetFrequency() / ((uint32_t)SoftwareUart_Prescaler[cs] * baud)) <= 0xFF)
+			{
+				break;
+			}
+		}
+		if(cs == TIMER_PRESCALER_MAX)
+		{
+			return false;
+		}
+		TCCR0A = 0x00;	// Normal mode
+		TCCR0B = cs;
+	}
+	else if(cs >= TIMER_PRESCALER_MAX)
+	{
+		return false;	// Timer0 clocked from T0 pin
+	}
+
+	ticks = (Clock_GetFrequency() + ((uint32_t)SoftwareUart_Prescaler[cs] * baud / 2)) / ((uint32_t)SoftwareUart_Prescaler[cs] * baud);
+	if((ticks == 0) || (ticks > 0xFF) || ((ticks * SoftwareUart_Prescaler[cs]) < SOFTWARE_UART_MIN_CYCLES))
+	{
+		return false;
+	}
+
+	/* the bit time is rounded to whole timer ticks, refuse rates that end up
+	   more than 2% off: the receiver samples the last bits too late or early */
+	wanted = Clock_GetFrequency();
+	error = ticks * SoftwareUart_Prescaler[cs] * baud;
+	error = (error > wanted) ? (error - wanted) : (wanted - error);
+	if((error * SOFTWARE_UART_MAX_ERROR) > wanted)
+	{
+		return false;
+	}
+
+	TIMSK &= ~(1 << OCIE0A);
+	SoftwareUart.Mask = (1 << pin);
+	SoftwareUart.BitTicks = (uint8_t)ticks;
+	SoftwareUart.Bits = 0;
+	SoftwareUart_Head = 0;
+	SoftwareUart_Tail = 0;
+	DigitalPin_Write(pin, HIGH);	// line idles at mark
+	DigitalPin_Init(pin, OUTPUT);
+	SoftwareUart.StsInit = true;
+	sei();
+	return true;
+}
+
+/**
+ * @brief Queues one byte. Never waits for the line: when the buffer is
+ *        full the byte is dropped so the caller's timing is not affected.
+ * @param data
+ * @return false if the byte was dropped
+ */
+bool SoftwareUart_Write(uint8_t data)
+{
+	uint8_t head = SoftwareUart_Head;
+	uint8_t next = (head + 1) & SOFTWARE_UART_BUFFER_MASK;
+	uint8_t sreg;
+
+	if((SoftwareUart.StsInit == false) || (next == SoftwareUart_Tail))
+	{
+		return false;
+	}
+
+	SoftwareUart_Buffer[head] = data;
+	SoftwareUart_Head = next;
+
+	if(!(TIMSK & (1 << OCIE0A)))
+	{
+		/* Transmitter idle: send one stop bit to load the queue from the ISR */
+		sreg = SREG;
+		cli();
+		SoftwareUart.Frame = 1;
+		SoftwareUart.Bits = 1;
+		OCR0A = TCNT0 + SoftwareUart.BitTicks;
+		TIFR = (1 << OCF0A);
+		TIMSK |= (1 << OCIE0A);
+		SREG = sreg;
+	}
+	return true;
+}
+
+/**
+ * @brief
+ * @param str
+ * @return number of bytes queued
+ */
+uint8_t SoftwareUart_Print(const char *str)
+{
+	uint8_t n = 0;
+
+	if(str != NULL)
+	{
+		while((*str != '\0') && SoftwareUart_Write((uint8_t)*str++))
+		{
+			n++;
+		}
+	}
+	return n;
+}
+
+/**
+ * @brief Decimal formatter that does not depend on printf
+ * @param value
+ * @return number of bytes queued
+ */
+uint8_t SoftwareUart_PrintUint(uint16_t value)
+{
+	char digits[6];
+	uint8_t i = sizeof(digits) - 1;
+
+	digits[i] = '\0';
+	do
+	{
+		digits[--i] = '0' + (value % 10);
+		value /= 10;
+	} while(value != 0);
+
+	return SoftwareUart_Print(&digits[i]);
+}
+
+/**
+ * @brief
+ * @param value
+ * @return number of bytes queued
+ */
+uint8_t SoftwareUart_PrintInt(int16_t value)
+{
+	if(value < 0)
+	{
+		if(SoftwareUart_Write('-') == false)
+		{
+			return 0;
+		}
+		return 1 + SoftwareUart_PrintUint((uint16_t)(-(int32_t)value));
+	}
+	return SoftwareUart_PrintUint((uint16_t)value);
+}
+
+/**
+ * @brief
+ * @return true when the buffer is empty and the last frame has been sent
+ */
+bool SoftwareUart_IsIdle(void)
+{
+	return !(TIMSK & (1 << OCIE0A));
+}
+
+/**
+ * @brief Blocks until everything queued has been transmitted
+ */
+void SoftwareUart_Flush(void)
+{
+	while(SoftwareUart_IsIdle() == false);
+}
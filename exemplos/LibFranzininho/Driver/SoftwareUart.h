@@ -0,0 +1,27 @@
+/*
+ * SoftwareUart.h
+ *
+ * Created: 19/10/2026 09:49:10
+ */
+#ifndef SOFTWAREUART_H_
+#define SOFTWAREUART_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Size of the transmit ring buffer, must be a power of two
+ */
+#ifndef SOFTWARE_UART_BUFFER_SIZE
+#define SOFTWARE_UART_BUFFER_SIZE	32
+#endif
+
+bool SoftwareUart_Init(uint8_t pin, uint32_t baud);
+bool SoftwareUart_Write(uint8_t data);
+uint8_t SoftwareUart_Print(const char *str);
+uint8_t SoftwareUart_PrintUint(uint16_t value);
+uint8_t SoftwareUart_PrintInt(int16_t value);
+bool SoftwareUart_IsIdle(void);
+void SoftwareUart_Flush(void);
+
+#endif /* SOFTWAREUART_H_ */
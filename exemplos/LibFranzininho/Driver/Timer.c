@@ -15,18 +15,46 @@
 #include <stddef.h>
 #include "Timer.h"
 
-
+#define TIMER_CS_MASK		0x07	// CS02:0 bits of TCCR0B
+#define TIMER_COUNTS		256UL	// Timer0 always runs the full 8 bits
 
 /** 
  * @brief 
  */
 void (*timer_irq)(void);
 
+/**
+ * @brief Overflows per tick (set by Timer_Rescale). Timer0 is never
+ *        preloaded, so OCR0A users such as SoftwareUart see every count.
+ */
+static uint16_t timer_divider = 1;
+static uint16_t timer_count = 1;
+
+/**
+ * @brief Set by Timer_EnableEvent (TimerEvent.c), which is a separate
+ *        object so the EventQueue is only linked when events are used
+ */
+void (*timer_event)(void) = NULL;
+
+/**
+ * @brief Clock divisor for each TIMER_PRESCALER_xxx value
+ */
+static const uint16_t timer_prescaler[TIMER_PRESCALER_MAX] = {0, 1, 8, 64, 256, 1024};
+
 /**
  * @brief 
  */ 
 ISR (TIMER0_OVF_vect)      //Interrupt vector for Timer0
 {
+  if(--timer_count != 0)
+  {
+    return;
+  }
+  timer_count = timer_divider;
+  if(timer_event != NULL)
+  {
+    timer_event();
+  }
   if(timer_irq != NULL)
   {
     timer_irq();
@@ -44,17 +72,82 @@ void Timer_Init(uint8_t prescaler)
   TCCR0B |= prescaler;
   sei();				//enabling global interrupt
   TCNT0 = 0;
+  timer_divider = 1;
+  timer_count = 1;
   TIMSK |= (1<<TOIE0); //enabling timer0 interrupt
 }
 
 /**
  * @brief
- * @param (*task)(void)
+ * @param (*task)(void) NULL detaches the current callback
  */
 void Timer_SetCallback(void (*task)(void))
 {
-  if(task != NULL)
+  uint8_t sreg = SREG;
+
+  cli();
+  timer_irq = task;
+  SREG = sreg;
+}
+
+/**
+ * @brief Lets a driver that borrows Timer0 put the callback back
+ * @return
+ */
+void (*Timer_GetCallback(void))(void)
+{
+  void (*task)(void);
+  uint8_t sreg = SREG;
+
+  cli();
+  task = timer_irq;
+  SREG = sreg;
+  return task;
+}
+
+/**
+ * @brief Keeps the tick period when the CPU clock is divided by 2^shift
+ *        (negative shift: multiplied). Timer0 keeps counting all 256 steps;
+ *        the largest prescaler that divides the period evenly is chosen and
+ *        the rest is made up by calling back only every Nth overflow.
+ * @param shift
+ * @return false if no setting gives the same period, nothing is changed
+ */
+bool Timer_Rescale(int8_t shift)
+{
+  uint8_t cs = TCCR0B & TIMER_CS_MASK;
+  uint32_t period = 0;
+  uint32_t overflow = 0;
+
+  if((cs == 0) || (cs >= TIMER_PRESCALER_MAX) || (shift == 0))
   {
-    timer_irq = task;
+    return true;  //stopped or clocked from the T0 pin
   }
-}
\ No newline at end of file
+
+  period = (uint32_t)timer_prescaler[cs] * TIMER_COUNTS * timer_divider;
+  if(shift > 0)
+  {
+    if(period & ((1UL << shift) - 1))
+    {
+      return false;
+    }
+    period >>= shift;
+  }
+  else
+  {
+    period <<= -shift;
+  }
+
+  for(cs = TIMER_PRESCALER_MAX - 1; cs >= TIMER_NO_PRESCALER; cs--)
+  {
+    overflow = (uint32_t)timer_prescaler[cs] * TIMER_COUNTS;
+    if(((period % overflow) == 0) && ((period / overflow) <= 0xFFFF))
+    {
+      TCCR0B = (TCCR0B & ~TIMER_CS_MASK) | cs;
+      timer_divider = (uint16_t)(period / overflow);
+      timer_count = timer_divider;
+      return true;
+    }
+  }
+  return false;  //shorter than 256 counts at the new clock
+}
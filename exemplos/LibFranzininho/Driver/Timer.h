@@ -28,6 +28,11 @@
 #define TIMER_PRESCALER_256		4
 #define TIMER_PRESCALER_1024	5
 #define TIMER_PRESCALER_MAX		6
+#define TIMER_EXTERNAL_FALLING	6	/* Timer counts falling edges on T0 (PB2) */
+#define TIMER_EXTERNAL_RISING	7	/* Timer counts rising edges on T0 (PB2)  */
 
 void Timer_Init(uint8_t prescaler);
-void Timer_SetCallback(void (*task)(void));
\ No newline at end of file
+void Timer_SetCallback(void (*task)(void));
+void (*Timer_GetCallback(void))(void);
+void Timer_EnableEvent(bool enable);
+bool Timer_Rescale(int8_t shift);
\ No newline at end of file
@@ -0,0 +1,52 @@
+/*
+ * Timer1Pwm.c
+ *
+ * Created: 19/10/2026 10:26:58
+ */
+#include <avr/io.h>
+#include "Timer1Pwm.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+/**
+ * @brief Starts the PLL if needed, selects it as the Timer1 clock and
+ *        enables PWM on the requested outputs
+ * @param cs TIMER1_PWM_CS(prescaler)
+ * @param duty initial compare value of both channels
+ * @param channel_a drive OC1A (PB1)
+ * @param channel_b drive OC1B (PB4)
+ */
+void Timer1Pwm_Init(uint8_t cs, uint8_t duty, bool channel_a, bool channel_b)
+{
+	if(!(PLLCSR & (1 << PLLE)))
+	{
+		PLLCSR |= (1 << PLLE);
+		while(!(PLLCSR & (1 << PLOCK)));
+	}
+	PLLCSR |= (1 << PCKE);
+
+	OCR1C = TIMER1_PWM_TOP;
+	OCR1A = duty;
+	OCR1B = duty;
+	TCNT1 = 0;
+	TCCR1 = (1 << PWM1A) | cs;
+	GTCCR = (GTCCR & ~((1 << COM1B1) | (1 << COM1B0))) | (1 << PWM1B);
+	if(channel_a == true)
+	{
+		TCCR1 |= (1 << COM1A1);
+		DigitalPin_Init(PB1, OUTPUT);
+	}
+	if(channel_b == true)
+	{
+		GTCCR |= (1 << COM1B1);
+		DigitalPin_Init(PB4, OUTPUT);
+	}
+}
+
+/**
+ * @brief Stops Timer1 and releases the PWM pins, the PLL keeps running
+ */
+void Timer1Pwm_Off(void)
+{
+	TCCR1 = 0x00;
+	GTCCR &= ~((1 << PWM1B) | (1 << COM1B1) | (1 << COM1B0));
+}
@@ -0,0 +1,39 @@
+/*
+ * Timer1Pwm.h
+ *
+ * Created: 19/10/2026 10:27:04
+ */
+#ifndef TIMER1PWM_H_
+#define TIMER1PWM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Timer1 8 bit fast PWM clocked from the PLL on OC1A (PB1) and
+ *        OC1B (PB4), the common setup of Dds and Dac. The period is
+ *        256 PLL clocks / prescaler; no interrupt is enabled here.
+ */
+#define TIMER1_PWM_TOP			0xFF
+
+/**
+ * @brief PLL clock (PCK). The board fuses (lfuse 0xE1) run the core from
+ *        the PLL divided by 4, so PCK follows the calibrated F_CPU: 66 MHz
+ *        at 16.5 MHz, not the nominal 64 MHz. One PWM period is always
+ *        256 * prescaler / 4 CPU cycles.
+ */
+#define TIMER1_PWM_PCK			(4UL * F_CPU)
+
+/**
+ * @brief TCCR1 CS13:0 for PCK / prescaler, 0 (timer stopped) unless the
+ *        prescaler is a power of two 1..64. Usable in #if.
+ */
+#define TIMER1_PWM_CS(prescaler)	\
+	(((prescaler) == 1) ? 1 : ((prescaler) == 2) ? 2 : ((prescaler) == 4) ? 3 : \
+	 ((prescaler) == 8) ? 4 : ((prescaler) == 16) ? 5 : ((prescaler) == 32) ? 6 : \
+	 ((prescaler) == 64) ? 7 : 0)
+
+void Timer1Pwm_Init(uint8_t cs, uint8_t duty, bool channel_a, bool channel_b);
+void Timer1Pwm_Off(void);
+
+#endif /* TIMER1PWM_H_ */
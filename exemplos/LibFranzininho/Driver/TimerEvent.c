@@ -0,0 +1,33 @@
+/*
+ * TimerEvent.c
+ *
+ * Created: 19/10/2026 10:17:40
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <stddef.h>
+#include "Timer.h"
+#include "../Util/EventQueue.h"
+
+extern void (*timer_event)(void);
+
+/**
+ * @brief
+ */
+static void Timer_PostEvent(void)
+{
+  EventQueue_Post(EVENT_TIMER, 0);
+}
+
+/**
+ * @brief Posts an EVENT_TIMER to the EventQueue on every tick
+ * @param enable
+ */
+void Timer_EnableEvent(bool enable)
+{
+  uint8_t sreg = SREG;
+
+  cli();                //the ISR must not see half of the pointer
+  timer_event = (enable == true) ? Timer_PostEvent : NULL;
+  SREG = sreg;
+}
@@ -0,0 +1,220 @@
+/*
+ * Touch.c
+ *
+ * Created: 19/10/2026 10:03:50
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "Touch.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define TOUCH_NO_CHANNEL		0xFF
+
+/** @brief */
+typedef struct
+{
+	uint8_t Mask;
+	uint8_t Channel;
+	filter_ema_t Signal;
+	filter_ema_t Baseline;
+	uint16_t Level;				// last Baseline output
+	int16_t Delta;
+	bool Touched;
+}touch_key_t;
+
+/** @brief */
+typedef struct
+{
+	uint8_t Count;
+	uint8_t Key;				// key being converted
+	bool Pending;
+	bool StsInit;
+}touch_t;
+
+/** @brief ADC channel of each PB pin */
+static const uint8_t Touch_Channel[] = {TOUCH_NO_CHANNEL, TOUCH_NO_CHANNEL, 1, 3, 2, 0};
+
+static volatile touch_t Touch = {0};
+static touch_key_t Touch_Key[TOUCH_MAX_KEYS];
+
+static void Touch_Measure(touch_key_t *key);
+static void Touch_Process(touch_key_t *key, uint16_t sample);
+
+/**
+ * @brief Enables the ADC with VCC as reference
+ */
+void Touch_Init(void)
+{
+	AnalogPin_Init();
+	AnalogPin_SetReference(ANALOG_PIN_REF_VCC);
+	Touch.Count = 0;
+	Touch.Key = 0;
+	Touch.Pending = false;
+	Touch.StsInit = true;
+}
+
+/**
+ * @brief Adds a key, keys are numbered in the order they are attached.
+ *        The pin is driven low between measurements.
+ * @param pin PB2..PB5
+ * @return false if the pin has no ADC channel or all keys are in use
+ */
+bool Touch_Attach(uint8_t pin)
+{
+	touch_key_t *key;
+	uint8_t sreg;
+
+	if((Touch.StsInit == false) || (pin >= sizeof(Touch_Channel)) ||
+	   (Touch_Channel[pin] == TOUCH_NO_CHANNEL) || (Touch.Count >= TOUCH_MAX_KEYS))
+	{
+		return false;
+	}
+
+	key = &Touch_Key[Touch.Count];
+	key->Mask = (1 << pin);
+	key->Channel = Touch_Channel[pin];
+	Filter_EmaInit(&key->Signal, TOUCH_SIGNAL_SHIFT);
+	Filter_EmaInit(&key->Baseline, TOUCH_BASELINE_SHIFT);
+	key->Level = 0;
+	key->Delta = 0;
+	key->Touched = false;
+
+	DIDR0 |= key->Mask;				// digital input off, less leakage
+	DigitalPin_Write(pin, LOW);
+	DigitalPin_Init(pin, OUTPUT);
+
+	sreg = SREG;
+	cli();
+	Touch.Count++;
+	SREG = sreg;
+	return true;
+}
+
+/**
+ * @brief Finishes the pending measurement and starts the next key.
+ *        The EMAs count samples, not time: a steady tick keeps the touch
+ *        response and the baseline drift rate constant.
+ */
+void Touch_Tick(void)
+{
+	touch_key_t *key;
+
+	if(Touch.Count == 0)
+	{
+		return;
+	}
+
+	if(Touch.Pending == true)
+	{
+		if(AnalogPin_IsBusy())
+		{
+			return;
+		}
+		key = &Touch_Key[Touch.Key];
+		Touch_Process(key, AnalogPin_GetResult());
+		DDRB |= key->Mask;				// ground the electrode until next time
+		if(++Touch.Key >= Touch.Count)
+		{
+			Touch.Key = 0;
+		}
+	}
+
+	Touch_Measure(&Touch_Key[Touch.Key]);
+	Touch.Pending = true;
+}
+
+/**
+ * @brief
+ * @param key
+ * @return debounced state
+ */
+bool Touch_IsTouched(uint8_t key)
+{
+	return (key < Touch.Count) ? Touch_Key[key].Touched : false;
+}
+
+/**
+ * @brief Signal minus baseline, useful to choose the thresholds
+ * @param key
+ * @return ADC counts
+ */
+int16_t Touch_GetDelta(uint8_t key)
+{
+	int16_t delta = 0;
+	uint8_t sreg;
+
+	if(key < Touch.Count)
+	{
+		sreg = SREG;
+		cli();
+		delta = Touch_Key[key].Delta;
+		SREG = sreg;
+	}
+	return delta;
+}
+
+/**
+ * @brief Takes the next sample of every key as its new baseline, e.g. if a
+ *        key stays touched after the panel was moved. Keep hands off.
+ */
+void Touch_Recalibrate(void)
+{
+	uint8_t sreg = SREG;
+	uint8_t i;
+
+	cli();
+	for(i = 0; i < Touch.Count; i++)
+	{
+		Filter_EmaInit(&Touch_Key[i].Baseline, TOUCH_BASELINE_SHIFT);
+		Touch_Key[i].Touched = false;
+	}
+	SREG = sreg;
+}
+
+/**
+ * @brief Charges the electrode, empties the S/H capacitor, then shares the
+ *        charge between them and starts the conversion.
+ * @param key
+ */
+static void Touch_Measure(touch_key_t *key)
+{
+	PORTB |= key->Mask;					// electrode to VCC
+	AnalogPin_Select(ANALOG_PIN_CH_GND);
+	Clock_DelayUs(TOUCH_CHARGE_US);
+	DDRB &= ~key->Mask;					// float (pull-up for a moment)
+	PORTB &= ~key->Mask;
+	AnalogPin_Select(key->Channel);
+	AnalogPin_Start();
+}
+
+/**
+ * @brief
+ * @param key
+ * @param sample
+ */
+static void Touch_Process(touch_key_t *key, uint16_t sample)
+{
+	uint16_t signal = Filter_EmaUpdate(&key->Signal, sample);
+
+	if(key->Baseline.Primed == false)
+	{
+		key->Level = Filter_EmaUpdate(&key->Baseline, signal);
+	}
+	key->Delta = (int16_t)signal - (int16_t)key->Level;
+
+	if(key->Touched == true)
+	{
+		if(key->Delta < TOUCH_THRESHOLD_OFF)
+		{
+			key->Touched = false;
+		}
+	}
+	else if(key->Delta >= TOUCH_THRESHOLD_ON)
+	{
+		key->Touched = true;
+	}
+	else
+	{
+		key->Level = Filter_EmaUpdate(&key->Baseline, signal);
+	}
+}
@@ -0,0 +1,54 @@
+/*
+ * Touch.h
+ *
+ * Created: 19/10/2026 10:03:58
+ */
+#ifndef TOUCH_H_
+#define TOUCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Capacitive touch keys on ADC pins (PB2, PB3, PB4; PB5 while it is
+ *        not the reset pin), no external parts besides the electrode.
+ *        Charge sharing: the electrode is charged to VCC while the ADC
+ *        sample and hold capacitor is grounded, then the electrode is left
+ *        floating and connected to the ADC, so the result grows with the
+ *        electrode capacitance (a finger adds a few pF).
+ *
+ * Touch_Tick measures one key per call and never waits for the ADC: each
+ * call reads the conversion started by the previous one (~15 us earlier at
+ * the default /16 ADC clock, so any tick rate from 1 kHz down works). With
+ * N keys every key is sampled every N ticks. The ADC reference is set to
+ * VCC; while touch keys are scanned the ADC must not be used elsewhere.
+ *
+ * A fast EMA smooths the samples and a slow one tracks the untouched
+ * baseline, frozen while the key is touched. A key is touched when the
+ * signal rises TOUCH_THRESHOLD_ON counts above the baseline and released
+ * when it falls below TOUCH_THRESHOLD_OFF.
+ */
+#ifndef TOUCH_MAX_KEYS
+#define TOUCH_MAX_KEYS			4
+#endif
+
+#ifndef TOUCH_THRESHOLD_ON
+#define TOUCH_THRESHOLD_ON		16		// ADC counts above baseline
+#endif
+
+#ifndef TOUCH_THRESHOLD_OFF
+#define TOUCH_THRESHOLD_OFF		8
+#endif
+
+#define TOUCH_SIGNAL_SHIFT		2		// EMA 1/4
+#define TOUCH_BASELINE_SHIFT	6		// EMA 1/64
+#define TOUCH_CHARGE_US			4		// S/H discharge time
+
+void Touch_Init(void);
+bool Touch_Attach(uint8_t pin);
+void Touch_Tick(void);
+bool Touch_IsTouched(uint8_t key);
+int16_t Touch_GetDelta(uint8_t key);
+void Touch_Recalibrate(void);
+
+#endif /* TOUCH_H_ */
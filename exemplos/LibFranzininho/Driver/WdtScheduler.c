@@ -0,0 +1,152 @@
+/*
+ * WdtScheduler.c
+ *
+ * Created: 19/10/2026 09:51:40
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+#include <stddef.h>
+#include "WdtScheduler.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define WDT_SCHEDULER_MAX_STEP	9		// 2^9 ticks = 8 s, longest watchdog period
+
+/** @brief */
+typedef struct
+{
+	void (*Job)(void);
+	uint16_t Period;		// in watchdog ticks
+	uint16_t Remaining;
+}wdt_scheduler_job_t;
+
+static wdt_scheduler_job_t WdtScheduler_Jobs[WDT_SCHEDULER_MAX_JOBS];
+static uint8_t WdtScheduler_NumJobs = 0;
+static uint8_t WdtScheduler_Step = 0;		// current watchdog period, log2 of ticks
+static volatile bool WdtScheduler_Expired = false;
+
+static void WdtScheduler_Program(void);
+
+/**
+ * @brief Only flags the wake-up, jobs run from WdtScheduler_Sleep in
+ *        main context so they may use blocking drivers such as the ADC.
+ */
+ISR (WDT_vect)
+{
+	WdtScheduler_Expired = true;
+}
+
+/**
+ * @brief
+ */
+void WdtScheduler_Init(void)
+{
+	WdtScheduler_NumJobs = 0;
+	WdtScheduler_Expired = false;
+#ifdef WDT_SCHEDULER_PROFILE_PIN
+	DigitalPin_Init(WDT_SCHEDULER_PROFILE_PIN, OUTPUT);
+#endif
+}
+
+/**
+ * @brief
+ * @param job function called every period ticks
+ * @param period in watchdog ticks, see WDT_SCHEDULER_MS()
+ * @return false if the job table is full
+ */
+bool WdtScheduler_AddJob(void (*job)(void), uint16_t period)
+{
+	if((job == NULL) || (period == 0) || (WdtScheduler_NumJobs >= WDT_SCHEDULER_MAX_JOBS))
+	{
+		return false;
+	}
+
+	WdtScheduler_Jobs[WdtScheduler_NumJobs].Job = job;
+	WdtScheduler_Jobs[WdtScheduler_NumJobs].Period = period;
+	WdtScheduler_Jobs[WdtScheduler_NumJobs].Remaining = period;
+	WdtScheduler_NumJobs++;
+	WdtScheduler_Program();
+	return true;
+}
+
+/**
+ * @brief Sleeps in power-down until an interrupt wakes the chip. If it was
+ *        the watchdog, due jobs are run and the next period is programmed.
+ *        Call it in the main loop; it also returns after other wake-ups
+ *        (pin change, INT0) so the application can handle them.
+ */
+void WdtScheduler_Sleep(void)
+{
+	uint8_t adcsra;
+	uint8_t i;
+
+	cli();
+	if(WdtScheduler_Expired == false)
+	{
+		adcsra = ADCSRA;
+		ADCSRA &= ~(1 << ADEN);				// ADC would keep drawing current
+#ifdef WDT_SCHEDULER_PROFILE_PIN
+		DigitalPin_Write(WDT_SCHEDULER_PROFILE_PIN, LOW);
+#endif
+		set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+		sleep_enable();
+		sleep_bod_disable();
+		sei();								// sleep executes before any ISR
+		sleep_cpu();
+		sleep_disable();
+#ifdef WDT_SCHEDULER_PROFILE_PIN
+		DigitalPin_Write(WDT_SCHEDULER_PROFILE_PIN, HIGH);
+#endif
+		ADCSRA = adcsra;
+	}
+	sei();
+
+	if(WdtScheduler_Expired == true)
+	{
+		WdtScheduler_Expired = false;
+		for(i = 0; i < WdtScheduler_NumJobs; i++)
+		{
+			WdtScheduler_Jobs[i].Remaining -= (1 << WdtScheduler_Step);
+			if(WdtScheduler_Jobs[i].Remaining == 0)
+			{
+				WdtScheduler_Jobs[i].Remaining = WdtScheduler_Jobs[i].Period;
+				WdtScheduler_Jobs[i].Job();
+			}
+		}
+		WdtScheduler_Program();
+	}
+}
+
+/**
+ * @brief Picks the longest watchdog period not past the next due job and
+ *        starts the watchdog in interrupt mode (no reset).
+ */
+static void WdtScheduler_Program(void)
+{
+	uint16_t next = 0xFFFF;
+	uint8_t step = 0;
+	uint8_t sreg;
+	uint8_t i;
+
+	for(i = 0; i < WdtScheduler_NumJobs; i++)
+	{
+		if(WdtScheduler_Jobs[i].Remaining < next)
+		{
+			next = WdtScheduler_Jobs[i].Remaining;
+		}
+	}
+	while((step < WDT_SCHEDULER_MAX_STEP) && ((2U << step) <= next))
+	{
+		step++;
+	}
+	WdtScheduler_Step = step;
+
+	sreg = SREG;
+	cli();
+	wdt_reset();
+	MCUSR &= ~(1 << WDRF);
+	WDTCR |= (1 << WDCE) | (1 << WDE);		// timed sequence, 4 cycles
+	WDTCR = (1 << WDIE) | ((step & 0x08) << 2) | (step & 0x07);
+	SREG = sreg;
+}
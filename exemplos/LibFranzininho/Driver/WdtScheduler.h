@@ -0,0 +1,44 @@
+/*
+ * WdtScheduler.h
+ *
+ * Created: 19/10/2026 09:51:58
+ */
+#ifndef WDTSCHEDULER_H_
+#define WDTSCHEDULER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Low rate scheduler woken by the watchdog interrupt, the only time
+ *        base still running in power-down (Timer0 and Timer1 stop there).
+ *
+ * Periods are counted in watchdog ticks of ~16 ms (2K cycles of the 128 kHz
+ * watchdog oscillator, which is only +/-10% accurate). Before each sleep the
+ * watchdog prescaler is set to the longest step (16 ms .. 8 s) that does not
+ * overshoot the next due job, so slow jobs cost few wake-ups.
+ *
+ * Awake time per wake-up (estimate at 16.5 MHz, Franzininho fuses):
+ *   - start-up delay from power-down set by the SUT fuses, 1K CK ~ 62 us
+ *   - WDT ISR plus job dispatch, ~120 cycles ~ 7 us
+ *   - AnalogPin_Read job: first conversion after the ADC is re-enabled takes
+ *     25 ADC clocks (ADC prescaler /16) = 400 cycles ~ 24 us
+ * So a wake-up with one ADC job stays awake for about 0.1 ms. Computed,
+ * not measured, at 10 mA active current: 0.1 ms / 8 s * 10 mA = 0.125 uA
+ * average at an 8 s period, 62 uA at 16 ms. At long periods the watchdog
+ * oscillator's own few uA in power-down dominates. Define
+ * WDT_SCHEDULER_PROFILE_PIN to drive a PB pin high while awake and measure
+ * the real figure with a scope.
+ */
+#ifndef WDT_SCHEDULER_MAX_JOBS
+#define WDT_SCHEDULER_MAX_JOBS	4
+#endif
+
+#define WDT_SCHEDULER_TICK_MS	16
+#define WDT_SCHEDULER_MS(ms)	((uint16_t)(((ms) + (WDT_SCHEDULER_TICK_MS / 2)) / WDT_SCHEDULER_TICK_MS))
+
+void WdtScheduler_Init(void);
+bool WdtScheduler_AddJob(void (*job)(void), uint16_t period);
+void WdtScheduler_Sleep(void);
+
+#endif /* WDTSCHEDULER_H_ */
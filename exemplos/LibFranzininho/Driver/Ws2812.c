@@ -0,0 +1,214 @@
+/*
+ * Ws2812.c
+ *
+ * Created: 19/10/2026 09:58:02
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <stddef.h>
+#include "Ws2812.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define WS2812_NOP1		"nop\n\t"
+#define WS2812_NOP2		"rjmp .+0\n\t"
+
+/**
+ * @brief Padding, in cycles, after the rising edge (T0H), between the two
+ *        possible falling edges (T1H) and before the next bit. See the
+ *        cycle counts in Ws2812_Show.
+ */
+#if (F_CPU == 16500000L) || (F_CPU == 16500000UL)
+#define WS2812_PAD_T0H	WS2812_NOP2 WS2812_NOP2					/* 4 */
+#define WS2812_PAD_T1H	WS2812_NOP2 WS2812_NOP2					/* 4 */
+#define WS2812_PAD_LOW	WS2812_NOP2 WS2812_NOP2					/* 4 */
+#elif (F_CPU == 16000000L) || (F_CPU == 16000000UL)
+#define WS2812_PAD_T0H	WS2812_NOP2 WS2812_NOP2					/* 4 */
+#define WS2812_PAD_T1H	WS2812_NOP2 WS2812_NOP2					/* 4 */
+#define WS2812_PAD_LOW	WS2812_NOP2 WS2812_NOP1					/* 3 */
+#elif (F_CPU == 8000000L) || (F_CPU == 8000000UL)
+#define WS2812_PAD_T0H	WS2812_NOP1								/* 1 */
+#define WS2812_PAD_T1H	WS2812_NOP1								/* 1 */
+#define WS2812_PAD_LOW	""										/* 0 */
+#else
+#error "Ws2812 timing is only defined for F_CPU of 8, 16 or 16.5 MHz"
+#endif
+
+/** @brief */
+typedef struct
+{
+	uint8_t *Buffer;
+	uint8_t Leds;
+	uint8_t Mask;
+	uint8_t Brightness;
+	bool StsInit;
+}ws2812_t;
+
+/** @brief Gamma 2.6 correction, perceived brightness becomes linear */
+static const uint8_t Ws2812_Gamma[256] PROGMEM =
+{
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,
+	  3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   5,   6,   6,   6,   6,   7,
+	  7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  10,  11,  11,  11,  12,  12,
+	 13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  20,
+	 20,  21,  21,  22,  22,  23,  24,  24,  25,  25,  26,  27,  27,  28,  29,  29,
+	 30,  31,  31,  32,  33,  34,  34,  35,  36,  37,  38,  38,  39,  40,  41,  42,
+	 42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,
+	 58,  59,  60,  61,  62,  63,  64,  65,  66,  68,  69,  70,  71,  72,  73,  75,
+	 76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,  90,  92,  93,  94,  96,
+	 97,  99, 100, 102, 103, 105, 106, 108, 109, 111, 112, 114, 115, 117, 119, 120,
+	122, 124, 125, 127, 129, 130, 132, 134, 136, 137, 139, 141, 143, 145, 146, 148,
+	150, 152, 154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180,
+	182, 184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
+	218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252, 255
+};
+
+static ws2812_t Ws2812 = {0};
+
+static uint8_t Ws2812_Scale(uint8_t value);
+
+/**
+ * @brief
+ * @param pin
+ * @param buffer WS2812_BYTES_PER_LED * leds bytes owned by the caller
+ * @param leds
+ */
+void Ws2812_Init(uint8_t pin, uint8_t *buffer, uint8_t leds)
+{
+	Ws2812.Buffer = buffer;
+	Ws2812.Leds = leds;
+	Ws2812.Mask = (1 << pin);
+	Ws2812.Brightness = 0xFF;
+	Ws2812.StsInit = (buffer != NULL);
+
+	DigitalPin_Write(pin, LOW);
+	DigitalPin_Init(pin, OUTPUT);
+	Ws2812_Clear();
+}
+
+/**
+ * @brief Stores a gamma corrected, brightness scaled color
+ * @param led
+ * @param red
+ * @param green
+ * @param blue
+ */
+void Ws2812_SetPixel(uint8_t led, uint8_t red, uint8_t green, uint8_t blue)
+{
+	uint8_t *p;
+
+	if((Ws2812.StsInit == false) || (led >= Ws2812.Leds))
+	{
+		return;
+	}
+	p = &Ws2812.Buffer[(uint16_t)led * WS2812_BYTES_PER_LED];
+	p[0] = Ws2812_Scale(green);
+	p[1] = Ws2812_Scale(red);
+	p[2] = Ws2812_Scale(blue);
+}
+
+/**
+ * @brief Applies to pixels set afterwards
+ * @param brightness 0..255
+ */
+void Ws2812_SetBrightness(uint8_t brightness)
+{
+	Ws2812.Brightness = brightness;
+}
+
+/**
+ * @brief
+ */
+void Ws2812_Clear(void)
+{
+	uint16_t i;
+
+	if(Ws2812.StsInit == false)
+	{
+		return;
+	}
+	for(i = 0; i < (uint16_t)Ws2812.Leds * WS2812_BYTES_PER_LED; i++)
+	{
+		Ws2812.Buffer[i] = 0;
+	}
+}
+
+/**
+ * @brief Sends the whole buffer, MSB first. Cycle count of one bit:
+ *
+ *   out hi              1   line high
+ *   T0H pad             A
+ *   sbrs / out lo       2   0 bit: line low after A + 2 cycles
+ *   dec                 1
+ *   T1H pad             B
+ *   out lo              1   1 bit: line low after A + B + 4 cycles
+ *   breq                1   (2 when the byte is done)
+ *   lsl                 1
+ *   low pad             C
+ *   rjmp                2   bit period 9 + A + B + C
+ *
+ *   byte done: breq 2, no lsl / pad / rjmp, then ld 2 + ldi 1 + sbiw 2
+ *   + brne 2, bit period 14 + A + B
+ *
+ *   The asm reads the buffer behind the compiler's back, hence the
+ *   "memory" clobber: pixels stored just before the call are flushed.
+ */
+void Ws2812_Show(void)
+{
+	uint8_t *ptr = Ws2812.Buffer;
+	uint16_t count = (uint16_t)Ws2812.Leds * WS2812_BYTES_PER_LED;
+	uint8_t byte;
+	uint8_t bit = 8;
+	uint8_t hi;
+	uint8_t lo;
+	uint8_t sreg;
+
+	if((Ws2812.StsInit == false) || (count == 0))
+	{
+		return;
+	}
+
+	byte = *ptr++;
+	sreg = SREG;
+	cli();
+	hi = PORTB | Ws2812.Mask;
+	lo = PORTB & ~Ws2812.Mask;
+
+	asm volatile(
+		"1:"							"\n\t"
+		"out  %[port], %[hi]"			"\n\t"
+		WS2812_PAD_T0H
+		"sbrs %[byte], 7"				"\n\t"
+		"out  %[port], %[lo]"			"\n\t"
+		"dec  %[bit]"					"\n\t"
+		WS2812_PAD_T1H
+		"out  %[port], %[lo]"			"\n\t"
+		"breq 2f"						"\n\t"
+		"lsl  %[byte]"					"\n\t"
+		WS2812_PAD_LOW
+		"rjmp 1b"						"\n\t"
+		"2:"							"\n\t"
+		"ld   %[byte], %a[ptr]+"		"\n\t"
+		"ldi  %[bit], 8"				"\n\t"
+		"sbiw %[count], 1"				"\n\t"
+		"brne 1b"						"\n\t"
+		: [byte] "+r" (byte), [bit] "+d" (bit), [ptr] "+e" (ptr), [count] "+w" (count)
+		: [port] "I" (_SFR_IO_ADDR(PORTB)), [hi] "r" (hi), [lo] "r" (lo)
+		: "memory"
+	);
+
+	SREG = sreg;
+}
+
+/**
+ * @brief
+ * @param value
+ * @return
+ */
+static uint8_t Ws2812_Scale(uint8_t value)
+{
+	value = pgm_read_byte(&Ws2812_Gamma[value]);
+	return (uint8_t)(((uint16_t)value * (Ws2812.Brightness + 1)) >> 8);
+}
@@ -0,0 +1,39 @@
+/*
+ * Ws2812.h
+ *
+ * Created: 19/10/2026 09:58:10
+ */
+#ifndef WS2812_H_
+#define WS2812_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief WS2812 / WS2812B addressable LED driver. The frame buffer holds
+ *        3 bytes per LED in wire order (G, R, B), already gamma corrected
+ *        and scaled by the brightness when a pixel is set, so Ws2812_Show
+ *        only streams bytes. Interrupts are masked while a frame is sent,
+ *        30 us per LED.
+ *
+ * Bit timing (T0H / T1H / bit period, data sheet 0.35 / 0.7 / 1.25 us):
+ *   16.5 MHz:  6 / 12 / 21 cycles = 0.36 / 0.73 / 1.27 us
+ *   16 MHz:    6 / 12 / 20 cycles = 0.38 / 0.75 / 1.25 us
+ *   8 MHz:     3 /  6 / 11 cycles = 0.38 / 0.75 / 1.38 us
+ * The last bit of each byte, where the next byte is fetched, takes 22
+ * cycles (8 MHz: 16): 1.33 / 1.38 us at 16 / 16.5 MHz, inside the data
+ * sheet's 1.25 +-0.6 us, but 2.0 us at 8 MHz, where only its low phase
+ * is stretched (1.6 us, far below the latch time). test/ws2812_timing.py
+ * steps the asm loop and checks these figures. The driver only builds
+ * for these three F_CPU values. Leave 300 us between frames so the LEDs
+ * latch.
+ */
+#define WS2812_BYTES_PER_LED	3
+
+void Ws2812_Init(uint8_t pin, uint8_t *buffer, uint8_t leds);
+void Ws2812_SetPixel(uint8_t led, uint8_t red, uint8_t green, uint8_t blue);
+void Ws2812_SetBrightness(uint8_t brightness);
+void Ws2812_Clear(void);
+void Ws2812_Show(void);
+
+#endif /* WS2812_H_ */
@@ -6,17 +6,54 @@
  */ 
 #include <stdbool.h>
 #include <stdint.h>
+
+/**
+ * Interrupt vectors owned by the drivers. An ISR can be defined only once,
+ * so drivers sharing a vector cannot be linked into the same program:
+ *   TIMER0_OVF_vect    Timer (the callback also drives FreqMeter frequency mode)
+ *   TIMER0_COMPA_vect  SoftwareUart
+ *   TIMER1_OVF_vect    Dds, Dac, FreqMeter
+ *   TIMER1_COMPA_vect  Servo, FreqMeter
+ *   PCINT0_vect        PinChange, Encoder, FreqMeter
+ *   ANA_COMP_vect      AnalogComparator_EnableEvent
+ *   EE_RDY_vect        Eeprom
+ *   WDT_vect           WdtScheduler
+ *
+ * Timer has a single callback. display595_Refresh, Encoder_Tick,
+ * Touch_Tick, ci74hc165_Scan and Task_Tick expect one call per tick; to
+ * run several, call them from one function passed to Timer_SetCallback.
+ */
+
 /** */
 #include "Driver/DigitalPin.h"
 #include "Driver/AnalogPin.h"
-#include "Driver/Pwm.h"
-#include "Driver/I2c.h"
 #include "Driver/Timer.h"
-#include "Driver/SoftwarePwm.h"
+#include "Driver/SoftwareUart.h"
+#include "Driver/Eeprom.h"
+#include "Driver/EepromLog.h"
+#include "Driver/WdtScheduler.h"
+#include "Driver/Clock.h"
+#include "Driver/PinChange.h"
+#include "Driver/Encoder.h"
+#include "Driver/FreqMeter.h"
+#include "Driver/Ws2812.h"
+#include "Driver/Timer1Pwm.h"
+#include "Driver/Dds.h"
+#include "Driver/Servo.h"
+#include "Driver/Touch.h"
+#include "Driver/Dac.h"
 
 /** */
 #include "Thirdpart/ci74hc595.h"
 #include "Thirdpart/lm35.h"
+#include "Thirdpart/display595.h"
+#include "Thirdpart/ci74hc165.h"
+
+/** */
+#include "Util/Filter.h"
+#include "Util/RingBuffer.h"
+#include "Util/EventQueue.h"
+#include "Util/Task.h"
 
 /** */
 #define  P0 0
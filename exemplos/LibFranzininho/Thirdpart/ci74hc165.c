@@ -0,0 +1,226 @@
+/*
+ * ci74hc165.c
+ *
+ * Created: 19/10/2026 10:02:21
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "ci74hc165.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+#define CI74HC165_BYTE			8
+#define CI74HC165_USI_CLK		PB2		// USCK
+#define CI74HC165_USI_DATA		PB0		// DI
+#define CI74HC165_USI_MODE		(1 << USIWM0)		// three wire
+#define CI74HC165_USI_STROBE	(CI74HC165_USI_MODE | (1 << USICS1) | (1 << USICLK) | (1 << USITC))
+
+/** @brief */
+typedef struct
+{
+	uint8_t LOAD;
+	uint8_t CLK;
+	uint8_t DATA;
+	uint8_t Bytes;
+	bool Usi;
+	bool StsInit;
+}ci74hc165_pin_t;
+
+/** @brief Per byte debounce state, two bit vertical counter in Ct0/Ct1 */
+typedef struct
+{
+	uint8_t Raw;
+	uint8_t State;
+	uint8_t Ct0;
+	uint8_t Ct1;
+	uint8_t Pressed;
+	uint8_t Released;
+}ci74hc165_input_t;
+
+static ci74hc165_pin_t ci74hc165_Pin = {0};
+static volatile ci74hc165_input_t ci74hc165_Input[CI74HC165_MAX_BYTES];
+
+static uint8_t ci74hc165_ShiftIn(void);
+static bool ci74hc165_TestAndClear(volatile uint8_t *flags, uint8_t input);
+
+/**
+ * @brief
+ * @param load SH/LD pin
+ * @param clk
+ * @param data QH pin of register 0
+ * @param bytes number of registers in the chain
+ */
+void ci74hc165_Init(uint8_t load, uint8_t clk, uint8_t data, uint8_t bytes)
+{
+	uint8_t i;
+
+	ci74hc165_Pin.LOAD = load;
+	ci74hc165_Pin.CLK = clk;
+	ci74hc165_Pin.DATA = data;
+	ci74hc165_Pin.Bytes = (bytes > CI74HC165_MAX_BYTES) ? CI74HC165_MAX_BYTES : bytes;
+	ci74hc165_Pin.Usi = (clk == CI74HC165_USI_CLK) && (data == CI74HC165_USI_DATA);
+
+	for(i = 0; i < CI74HC165_MAX_BYTES; i++)
+	{
+		ci74hc165_Input[i].State = 0;
+		ci74hc165_Input[i].Ct0 = 0xFF;
+		ci74hc165_Input[i].Ct1 = 0xFF;
+		ci74hc165_Input[i].Pressed = 0;
+		ci74hc165_Input[i].Released = 0;
+	}
+
+	DigitalPin_Write(load, HIGH);
+	DigitalPin_Init(load, OUTPUT);
+	DigitalPin_Write(clk, LOW);
+	DigitalPin_Init(clk, OUTPUT);
+	DigitalPin_Init(data, INPUT);
+	ci74hc165_Pin.StsInit = true;
+}
+
+/**
+ * @brief Latches all inputs, shifts the chain in and debounces it.
+ *        A change is accepted after 4 scans, so a scan every 2..5 ms
+ *        gives the usual 8..20 ms of debounce.
+ */
+void ci74hc165_Scan(void)
+{
+	volatile ci74hc165_input_t *in = ci74hc165_Input;
+	uint8_t raw;
+	uint8_t delta;
+	uint8_t i;
+
+	if(ci74hc165_Pin.StsInit == false)
+	{
+		return;
+	}
+
+	DigitalPin_Write(ci74hc165_Pin.LOAD, LOW);		// parallel load
+	DigitalPin_Write(ci74hc165_Pin.LOAD, HIGH);
+
+	for(i = 0; i < ci74hc165_Pin.Bytes; i++, in++)
+	{
+		raw = ci74hc165_ShiftIn();
+#if CI74HC165_ACTIVE_LOW
+		raw = ~raw;
+#endif
+		in->Raw = raw;
+
+		/* vertical counters: count only bits that differ from State */
+		delta = raw ^ in->State;
+		in->Ct0 = ~(in->Ct0 & delta);
+		in->Ct1 = in->Ct0 ^ (in->Ct1 & delta);
+		delta &= in->Ct0 & in->Ct1;				// counted to the end
+		in->State ^= delta;
+		in->Pressed |= in->State & delta;
+		in->Released |= ~in->State & delta;
+	}
+}
+
+/**
+ * @brief
+ * @param byte register index
+ * @return last raw snapshot, 1 = active
+ */
+uint8_t ci74hc165_Read(uint8_t byte)
+{
+	return (byte < CI74HC165_MAX_BYTES) ? ci74hc165_Input[byte].Raw : 0;
+}
+
+/**
+ * @brief
+ * @param input
+ * @return debounced state, true = active
+ */
+bool ci74hc165_GetState(uint8_t input)
+{
+	if((input / CI74HC165_BYTE) >= CI74HC165_MAX_BYTES)
+	{
+		return false;
+	}
+	return (ci74hc165_Input[input / CI74HC165_BYTE].State & (1 << (input % CI74HC165_BYTE))) != 0;
+}
+
+/**
+ * @brief
+ * @param input
+ * @return true once for every press
+ */
+bool ci74hc165_GetPressed(uint8_t input)
+{
+	if((input / CI74HC165_BYTE) >= CI74HC165_MAX_BYTES)
+	{
+		return false;
+	}
+	return ci74hc165_TestAndClear(&ci74hc165_Input[input / CI74HC165_BYTE].Pressed, input);
+}
+
+/**
+ * @brief
+ * @param input
+ * @return true once for every release
+ */
+bool ci74hc165_GetReleased(uint8_t input)
+{
+	if((input / CI74HC165_BYTE) >= CI74HC165_MAX_BYTES)
+	{
+		return false;
+	}
+	return ci74hc165_TestAndClear(&ci74hc165_Input[input / CI74HC165_BYTE].Released, input);
+}
+
+/**
+ * @brief Reads one register, MSB (input H) first
+ * @return
+ */
+static uint8_t ci74hc165_ShiftIn(void)
+{
+	uint8_t value = 0;
+	uint8_t i;
+
+	if(ci74hc165_Pin.Usi == true)
+	{
+		/* 16 strobes: each toggles USCK, the 165 shifts on the rising edge
+		   after the USI has sampled DI. Three wire mode is only on for the
+		   transfer: it hands PB1 to DO, which would override PORTB1 (board
+		   LED, OC1A) the rest of the time. */
+		USISR = (1 << USIOIF);
+		USICR = CI74HC165_USI_MODE;
+		for(i = 0; i < (2 * CI74HC165_BYTE); i++)
+		{
+			USICR = CI74HC165_USI_STROBE;
+		}
+		value = USIDR;
+		USICR = 0;
+		return value;
+	}
+
+	for(i = 0; i < CI74HC165_BYTE; i++)
+	{
+		value <<= 1;
+		if(DigitalPin_Read(ci74hc165_Pin.DATA))
+		{
+			value |= 1;
+		}
+		DigitalPin_Write(ci74hc165_Pin.CLK, HIGH);
+		DigitalPin_Write(ci74hc165_Pin.CLK, LOW);
+	}
+	return value;
+}
+
+/**
+ * @brief Flags are set from the scan (often in an ISR), clear atomically
+ * @param flags
+ * @param input
+ * @return
+ */
+static bool ci74hc165_TestAndClear(volatile uint8_t *flags, uint8_t input)
+{
+	uint8_t mask = (1 << (input % CI74HC165_BYTE));
+	bool set;
+	uint8_t sreg = SREG;
+
+	cli();
+	set = (*flags & mask) != 0;
+	*flags &= ~mask;
+	SREG = sreg;
+	return set;
+}
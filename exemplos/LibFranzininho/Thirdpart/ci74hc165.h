@@ -0,0 +1,43 @@
+/*
+ * ci74hc165.h
+ *
+ * Created: 19/10/2026 10:02:30
+ */
+#ifndef CI74HC165_H_
+#define CI74HC165_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Chain of 74HC165 parallel-in shift registers with debounced
+ *        buttons. When CLK is PB2 and DATA is PB0 the USI clocks the
+ *        chain, ~5 us per register at 16.5 MHz (16 USICR writes in a
+ *        loop, estimate); PB1 follows the USI data output during those
+ *        microseconds, if it is an output. Any other pins are bit banged
+ *        through DigitalPin_Read / DigitalPin_Write, three calls with a
+ *        variable shift per bit, roughly ten times slower. ci74hc165_Scan
+ *        takes a snapshot of the whole chain and runs a vertical counter
+ *        debounce on 8 inputs at a time: a button must read the same for
+ *        4 scans in a row to change state.
+ *
+ * Input n is bit (n % 8) of register (n / 8), register 0 being the one
+ * wired to the MCU and bit 7 its input H. Inputs are active low (button to
+ * GND with pull-up) unless CI74HC165_ACTIVE_LOW is defined as 0.
+ */
+#ifndef CI74HC165_MAX_BYTES
+#define CI74HC165_MAX_BYTES		4
+#endif
+
+#ifndef CI74HC165_ACTIVE_LOW
+#define CI74HC165_ACTIVE_LOW	1
+#endif
+
+void ci74hc165_Init(uint8_t load, uint8_t clk, uint8_t data, uint8_t bytes);
+void ci74hc165_Scan(void);
+uint8_t ci74hc165_Read(uint8_t byte);
+bool ci74hc165_GetState(uint8_t input);
+bool ci74hc165_GetPressed(uint8_t input);
+bool ci74hc165_GetReleased(uint8_t input);
+
+#endif /* CI74HC165_H_ */
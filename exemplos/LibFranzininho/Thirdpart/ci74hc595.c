@@ -5,12 +5,17 @@
  *  Author: evandro teixeira
  */ 
 #include <avr/io.h>
-#include <util/delay.h>
 #include "ci74hc595.h"
 #include "../../LibFranzininho/Franzininho.h"
 
 #define CI74HC595_BYTE			8
-#define CI74HC595_TIME_DELAY	10
+/** 
+ * @brief Clock and latch pulse width in us. The 74HC595 needs tens of ns,
+ *        already met by the DigitalPin_Write calls; raise it for long wires.
+ */
+#ifndef CI74HC595_TIME_DELAY
+#define CI74HC595_TIME_DELAY	0
+#endif
 
 /**  @brief */
 typedef struct
@@ -109,5 +114,8 @@ static void ci74hc595_Transmits_Data(uint16_t value, uint8_t num_byte)
  */
 static void ci74hc595_Delay(uint8_t t)
 {
-	_delay_us(t);
+	if(t != 0)
+	{
+		Clock_DelayUs(t);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,176 @@
+/*
+ * display595.c
+ *
+ * Created: 19/10/2026 09:53:28
+ */
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "display595.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+/** @brief */
+typedef struct
+{
+	uint8_t Rows;
+	uint8_t Brightness;
+	uint8_t SelectXor;
+	uint8_t SegmentXor;
+	uint8_t Row;		// row being shown
+	uint8_t Slot;		// Refresh calls since the row was selected
+	bool Lit;			// a row is driven
+	bool StsInit;
+}display595_t;
+
+/** @brief Segment patterns for 0-9, A-F, blank and minus */
+static const uint8_t display595_Font[] PROGMEM =
+{
+	0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,
+	0x7F, 0x6F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71,
+	0x00, 0x40
+};
+
+static display595_t display595 = {0};
+static volatile uint8_t display595_Frame[DISPLAY595_MAX_ROWS];
+
+static void display595_Output(uint8_t select, uint8_t segments);
+
+/**
+ * @brief
+ * @param clk
+ * @param latch
+ * @param data
+ * @param rows number of digits (rows), up to DISPLAY595_MAX_ROWS
+ * @param flags DISPLAY595_xxx_ACTIVE_LOW
+ */
+void display595_Init(uint8_t clk, uint8_t latch, uint8_t data, uint8_t rows, uint8_t flags)
+{
+	uint8_t i;
+
+	display595.StsInit = false;
+	for(i = 0; i < DISPLAY595_MAX_ROWS; i++)
+	{
+		display595_Frame[i] = 0;
+	}
+	display595.Rows = (rows > DISPLAY595_MAX_ROWS) ? DISPLAY595_MAX_ROWS : rows;
+	display595.Brightness = DISPLAY595_LEVELS;
+	display595.SelectXor = (flags & DISPLAY595_SELECT_ACTIVE_LOW) ? 0xFF : 0x00;
+	display595.SegmentXor = (flags & DISPLAY595_SEGMENT_ACTIVE_LOW) ? 0xFF : 0x00;
+	display595.Row = 0;
+	display595.Slot = 0;
+	display595.Lit = false;
+
+	ci74hc595_Init(clk, latch, data);
+	display595_Output(0, 0);
+	display595.StsInit = (display595.Rows != 0);
+}
+
+/**
+ * @brief Raw pattern, for LED matrices or custom glyphs
+ * @param row
+ * @param pattern
+ */
+void display595_SetRow(uint8_t row, uint8_t pattern)
+{
+	if(row < display595.Rows)
+	{
+		display595_Frame[row] = pattern;
+	}
+}
+
+/**
+ * @brief
+ * @param row
+ * @param value 0-15, DISPLAY595_BLANK or DISPLAY595_MINUS
+ * @param dot
+ */
+void display595_SetDigit(uint8_t row, uint8_t value, bool dot)
+{
+	uint8_t pattern = 0;
+
+	if(value < sizeof(display595_Font))
+	{
+		pattern = pgm_read_byte(&display595_Font[value]);
+	}
+	if(dot == true)
+	{
+		pattern |= DISPLAY595_DOT;
+	}
+	display595_SetRow(row, pattern);
+}
+
+/**
+ * @brief Right aligned decimal, row 0 is the leftmost digit
+ * @param value
+ */
+void display595_PrintUint(uint16_t value)
+{
+	uint8_t row = display595.Rows;
+
+	while(row-- > 0)
+	{
+		display595_SetDigit(row, value % 10, false);
+		value /= 10;
+		if(value == 0)
+		{
+			break;
+		}
+	}
+	while(row-- > 0)
+	{
+		display595_SetDigit(row, DISPLAY595_BLANK, false);
+	}
+}
+
+/**
+ * @brief
+ * @param level 0 (off) to DISPLAY595_LEVELS (full on time)
+ */
+void display595_SetBrightness(uint8_t level)
+{
+	display595.Brightness = (level > DISPLAY595_LEVELS) ? DISPLAY595_LEVELS : level;
+}
+
+/**
+ * @brief One multiplexing step. Each row gets DISPLAY595_LEVELS steps, so
+ *        the refresh rate is the call rate / (rows * DISPLAY595_LEVELS).
+ */
+void display595_Refresh(void)
+{
+	if(display595.StsInit == false)
+	{
+		return;
+	}
+
+	if((display595.Slot == 0) && (display595.Brightness != 0))
+	{
+		display595_Output((1 << display595.Row), display595_Frame[display595.Row]);
+		display595.Lit = true;
+	}
+	else if((display595.Lit == true) && (display595.Slot >= display595.Brightness))
+	{
+		/* >= so a brightness lowered while the row is on still blanks it */
+		display595_Output(0, 0);
+		display595.Lit = false;
+	}
+
+	if(++display595.Slot >= DISPLAY595_LEVELS)
+	{
+		display595.Slot = 0;
+		if(++display595.Row >= display595.Rows)
+		{
+			display595.Row = 0;
+		}
+	}
+}
+
+/**
+ * @brief
+ * @param select
+ * @param segments
+ */
+static void display595_Output(uint8_t select, uint8_t segments)
+{
+	select ^= display595.SelectXor;
+	segments ^= display595.SegmentXor;
+	ci74hc595_Transmits_16_Bits(((uint16_t)select << 8) | segments);
+}
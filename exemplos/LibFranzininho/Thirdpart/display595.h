@@ -0,0 +1,45 @@
+/*
+ * display595.h
+ *
+ * Created: 19/10/2026 09:53:45
+ */
+#ifndef DISPLAY595_H_
+#define DISPLAY595_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Multiplexed 7-segment / LED matrix display on two chained
+ *        74HC595: the high byte of each 16 bit transfer selects the digit
+ *        (row), the low byte carries its segments (columns). Segment bits
+ *        follow the usual order, bit 0 = a ... bit 6 = g, bit 7 = dp.
+ *
+ * Pass display595_Refresh to Timer_SetCallback. Each row stays selected
+ * for DISPLAY595_LEVELS ticks and is blanked after 'brightness' of them,
+ * so a 16 bit transfer (~50 us) happens at most twice per row and the
+ * other ticks cost a few cycles. With Timer_Init(TIMER_PRESCALER_8) the
+ * tick is 8 kHz and 4 digits refresh at 250 Hz.
+ */
+#ifndef DISPLAY595_MAX_ROWS
+#define DISPLAY595_MAX_ROWS		8
+#endif
+
+#define DISPLAY595_LEVELS		8
+
+/** @brief Polarity flags for display595_Init */
+#define DISPLAY595_SELECT_ACTIVE_LOW	0x01	// common cathode digits driven low
+#define DISPLAY595_SEGMENT_ACTIVE_LOW	0x02	// common anode segments
+
+#define DISPLAY595_DOT			0x80
+#define DISPLAY595_BLANK		0x10	// font index of an empty digit
+#define DISPLAY595_MINUS		0x11	// font index of '-'
+
+void display595_Init(uint8_t clk, uint8_t latch, uint8_t data, uint8_t rows, uint8_t flags);
+void display595_SetRow(uint8_t row, uint8_t pattern);
+void display595_SetDigit(uint8_t row, uint8_t value, bool dot);
+void display595_PrintUint(uint16_t value);
+void display595_SetBrightness(uint8_t level);
+void display595_Refresh(void);
+
+#endif /* DISPLAY595_H_ */
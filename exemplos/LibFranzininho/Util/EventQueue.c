@@ -0,0 +1,77 @@
+/*
+ * EventQueue.c
+ *
+ * Created: 19/10/2026 09:55:20
+ */
+#include "EventQueue.h"
+#include "RingBuffer.h"
+
+#define EVENT_QUEUE_BYTES	(EVENT_QUEUE_SIZE * 2)		// Type and Data
+
+#if (EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1)) != 0 || (EVENT_QUEUE_BYTES > RING_BUFFER_MAX_SIZE)
+#error "EVENT_QUEUE_SIZE must be a power of two up to 64"
+#endif
+
+/**
+ * @brief Events are stored as Type, Data byte pairs. Post checks for room
+ *        for both bytes and Get only takes an event once both are in, so
+ *        the consumer never sees half of one.
+ */
+static volatile uint8_t EventQueue_Storage[EVENT_QUEUE_BYTES];
+static ring_buffer_t EventQueue_Fifo = {EventQueue_Storage, 0, 0, EVENT_QUEUE_BYTES - 1};
+static volatile uint8_t EventQueue_Dropped = 0;
+
+/**
+ * @brief Drops pending events
+ */
+void EventQueue_Init(void)
+{
+	EventQueue_Fifo.Tail = EventQueue_Fifo.Head;
+	EventQueue_Dropped = 0;
+}
+
+/**
+ * @brief Producer side, normally called from an ISR
+ * @param type
+ * @param data
+ * @return false if the queue was full and the event was dropped
+ */
+bool EventQueue_Post(uint8_t type, uint8_t data)
+{
+	if(RingBuffer_Free(&EventQueue_Fifo) < sizeof(event_t))
+	{
+		if(EventQueue_Dropped != 0xFF)
+		{
+			EventQueue_Dropped++;
+		}
+		return false;
+	}
+	RingBuffer_Put(&EventQueue_Fifo, type);
+	RingBuffer_Put(&EventQueue_Fifo, data);
+	return true;
+}
+
+/**
+ * @brief Consumer side, called from the main loop
+ * @param event
+ * @return false if there is no pending event
+ */
+bool EventQueue_Get(event_t *event)
+{
+	if(RingBuffer_Count(&EventQueue_Fifo) < sizeof(event_t))
+	{
+		return false;
+	}
+	RingBuffer_Get(&EventQueue_Fifo, &event->Type);
+	RingBuffer_Get(&EventQueue_Fifo, &event->Data);
+	return true;
+}
+
+/**
+ * @brief
+ * @return events lost because the queue was full (saturates at 255)
+ */
+uint8_t EventQueue_GetDropped(void)
+{
+	return EventQueue_Dropped;
+}
@@ -0,0 +1,45 @@
+/*
+ * EventQueue.h
+ *
+ * Created: 19/10/2026 09:55:31
+ */
+#ifndef EVENTQUEUE_H_
+#define EVENTQUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Queue of events posted by interrupt handlers and consumed by the
+ *        main loop, in place of per example volatile flags. Interrupts do
+ *        not nest, so all ISRs together are the single producer and no
+ *        cli() is needed. To post from the main loop, disable interrupts
+ *        around EventQueue_Post.
+ */
+#ifndef EVENT_QUEUE_SIZE
+#define EVENT_QUEUE_SIZE	16		// power of two, up to 64
+#endif
+
+/** @brief Event types, applications may add their own from EVENT_USER */
+enum
+{
+	EVENT_NONE = 0,
+	EVENT_TIMER,			// Timer0 overflow tick
+	EVENT_COMPARATOR,		// analog comparator toggled, Data = ACO
+	EVENT_PIN_CHANGE,		// Data = PINB snapshot
+	EVENT_USER = 0x80
+};
+
+/** @brief */
+typedef struct
+{
+	uint8_t Type;
+	uint8_t Data;
+}event_t;
+
+void EventQueue_Init(void);
+bool EventQueue_Post(uint8_t type, uint8_t data);
+bool EventQueue_Get(event_t *event);
+uint8_t EventQueue_GetDropped(void);
+
+#endif /* EVENTQUEUE_H_ */
@@ -0,0 +1,205 @@
+/*
+ * Filter.c
+ *
+ * Created: 19/10/2026 09:54:18
+ */
+#include <string.h>
+#include "Filter.h"
+
+#if (FILTER_BOXCAR_SHIFT > 6)
+#error "FILTER_BOXCAR_SHIFT too large, the 16 bit sum would overflow"
+#endif
+
+#define FILTER_SWAP(a, b)	do { uint16_t t = (a); (a) = (b); (b) = t; } while(0)
+#define FILTER_SORT(a, b)	do { if((a) > (b)) FILTER_SWAP(a, b); } while(0)
+
+/**
+ * @brief
+ * @param f
+ * @param shift 0..FILTER_EMA_MAX_SHIFT
+ */
+void Filter_EmaInit(filter_ema_t *f, uint8_t shift)
+{
+	f->Acc = 0;
+	f->Shift = (shift > FILTER_EMA_MAX_SHIFT) ? FILTER_EMA_MAX_SHIFT : shift;
+	f->Primed = false;
+}
+
+/**
+ * @brief acc += x - acc / 2^shift, keeping the fraction bits in acc.
+ *        The first sample loads the filter so it does not ramp up from 0.
+ * @param f
+ * @param sample
+ * @return
+ */
+uint16_t Filter_EmaUpdate(filter_ema_t *f, uint16_t sample)
+{
+	if(f->Primed == false)
+	{
+		f->Acc = sample << f->Shift;
+		f->Primed = true;
+	}
+	else
+	{
+		f->Acc += sample - (f->Acc >> f->Shift);
+	}
+	return f->Acc >> f->Shift;
+}
+
+/**
+ * @brief
+ * @param f
+ */
+void Filter_BoxcarInit(filter_boxcar_t *f)
+{
+	memset(f, 0, sizeof(*f));
+}
+
+/**
+ * @brief Replaces the oldest sample in the sum, O(1) for any length.
+ *        The output ramps up over the first FILTER_BOXCAR_SIZE samples.
+ * @param f
+ * @param sample
+ * @return
+ */
+uint16_t Filter_BoxcarUpdate(filter_boxcar_t *f, uint16_t sample)
+{
+	f->Sum += sample - f->Samples[f->Index];
+	f->Samples[f->Index] = sample;
+	f->Index = (f->Index + 1) & (FILTER_BOXCAR_SIZE - 1);
+	return f->Sum >> FILTER_BOXCAR_SHIFT;
+}
+
+/**
+ * @brief
+ * @param f
+ */
+void Filter_Median3Init(filter_median3_t *f)
+{
+	memset(f, 0, sizeof(*f));
+}
+
+/**
+ * @brief Removes single sample spikes
+ * @param f
+ * @param sample
+ * @return
+ */
+uint16_t Filter_Median3Update(filter_median3_t *f, uint16_t sample)
+{
+	uint16_t a;
+	uint16_t b;
+	uint16_t c;
+
+	f->Samples[f->Index] = sample;
+	if(++f->Index >= 3)
+	{
+		f->Index = 0;
+	}
+
+	a = f->Samples[0];
+	b = f->Samples[1];
+	c = f->Samples[2];
+	FILTER_SORT(a, b);
+	FILTER_SORT(b, c);
+	FILTER_SORT(a, b);
+	return b;
+}
+
+/**
+ * @brief
+ * @param f
+ */
+void Filter_Median5Init(filter_median5_t *f)
+{
+	memset(f, 0, sizeof(*f));
+}
+
+/**
+ * @brief Removes spikes up to two samples long. Uses a 7 comparison
+ *        selection network instead of sorting the window.
+ * @param f
+ * @param sample
+ * @return
+ */
+uint16_t Filter_Median5Update(filter_median5_t *f, uint16_t sample)
+{
+	uint16_t a;
+	uint16_t b;
+	uint16_t c;
+	uint16_t d;
+	uint16_t e;
+
+	f->Samples[f->Index] = sample;
+	if(++f->Index >= 5)
+	{
+		f->Index = 0;
+	}
+
+	a = f->Samples[0];
+	b = f->Samples[1];
+	c = f->Samples[2];
+	d = f->Samples[3];
+	e = f->Samples[4];
+	FILTER_SORT(a, b);		// a <= b
+	FILTER_SORT(d, e);		// d <= e
+	if(a > d)				// drop the smallest of the four: min(a, d)
+	{
+		FILTER_SWAP(a, d);
+		FILTER_SWAP(b, e);
+	}
+	/* a is below three others, median is the 2nd smallest of b, c, d, e */
+	FILTER_SORT(b, c);		// b <= c
+	if(b > d)				// drop min(b, d)
+	{
+		FILTER_SWAP(b, d);
+		FILTER_SWAP(c, e);
+	}
+	/* median is the smallest of c, d */
+	return (c < d) ? c : d;
+}
+
+/**
+ * @brief
+ * @param f
+ * @param alpha weight of the new sample in 1/256 units (1..255)
+ */
+void Filter_IirInit(filter_iir_t *f, uint8_t alpha)
+{
+	f->State = 0;
+	f->Alpha = alpha;
+	f->Primed = false;
+}
+
+/**
+ * @brief y[n] = y[n-1] + alpha * (x[n] - y[n-1]), with the state kept in
+ *        Q10.5. The step is rounded and never smaller than one state LSB,
+ *        so the output settles exactly on a constant input for any alpha
+ *        (a truncated step would stop up to 8 LSB short with alpha = 1).
+ * @param f
+ * @param sample
+ * @return
+ */
+uint16_t Filter_IirUpdate(filter_iir_t *f, uint16_t sample)
+{
+	int16_t x = (int16_t)(sample << FILTER_IIR_SHIFT);
+	int16_t delta;
+	int16_t step;
+
+	if(f->Primed == false)
+	{
+		f->State = x;
+		f->Primed = true;
+	}
+	else
+	{
+		delta = x - f->State;
+		step = (int16_t)(((int32_t)delta * f->Alpha + 128) >> 8);
+		if((step == 0) && (delta != 0))
+		{
+			step = (delta > 0) ? 1 : -1;
+		}
+		f->State += step;
+	}
+	return (uint16_t)(f->State + (1 << (FILTER_IIR_SHIFT - 1))) >> FILTER_IIR_SHIFT;
+}
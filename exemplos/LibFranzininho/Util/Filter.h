@@ -0,0 +1,86 @@
+/*
+ * Filter.h
+ *
+ * Created: 19/10/2026 09:54:36
+ */
+#ifndef FILTER_H_
+#define FILTER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Integer filters for ADC sample streams (0..1023, AnalogPin_Read).
+ *        Each channel owns one statically allocated filter object; every
+ *        Update takes the new sample and returns the filtered value.
+ *
+ * Estimated cost per sample, avr-gcc -Os, counted by hand and not measured
+ * (the ATtiny85 has no hardware multiplier, so only the IIR multiplies):
+ *   EMA      ~25 + 4 * shift cycles
+ *   Boxcar   ~45 cycles
+ *   Median3  ~40 cycles
+ *   Median5  ~110 cycles
+ *   IIR      ~100 cycles
+ * A float low-pass costs well over 1000 cycles per sample on this core.
+ * Host tests for the filters are in test/ ("make test").
+ */
+
+/** @brief Boxcar length is 2^FILTER_BOXCAR_SHIFT samples (max 6) */
+#ifndef FILTER_BOXCAR_SHIFT
+#define FILTER_BOXCAR_SHIFT		3
+#endif
+#define FILTER_BOXCAR_SIZE		(1 << FILTER_BOXCAR_SHIFT)
+
+#define FILTER_EMA_MAX_SHIFT	6
+#define FILTER_IIR_SHIFT		5	// fraction bits of the IIR state
+
+/** @brief Exponential moving average, weight 1/2^shift */
+typedef struct
+{
+	uint16_t Acc;			// average << shift
+	uint8_t Shift;
+	bool Primed;
+}filter_ema_t;
+
+/** @brief Running sum over the last FILTER_BOXCAR_SIZE samples */
+typedef struct
+{
+	uint16_t Samples[FILTER_BOXCAR_SIZE];
+	uint16_t Sum;
+	uint8_t Index;
+}filter_boxcar_t;
+
+/** @brief Median of the last 3 samples */
+typedef struct
+{
+	uint16_t Samples[3];
+	uint8_t Index;
+}filter_median3_t;
+
+/** @brief Median of the last 5 samples */
+typedef struct
+{
+	uint16_t Samples[5];
+	uint8_t Index;
+}filter_median5_t;
+
+/** @brief First order low-pass y += alpha * (x - y), alpha in 1/256 units */
+typedef struct
+{
+	int16_t State;			// y << FILTER_IIR_SHIFT
+	uint8_t Alpha;
+	bool Primed;
+}filter_iir_t;
+
+void Filter_EmaInit(filter_ema_t *f, uint8_t shift);
+uint16_t Filter_EmaUpdate(filter_ema_t *f, uint16_t sample);
+void Filter_BoxcarInit(filter_boxcar_t *f);
+uint16_t Filter_BoxcarUpdate(filter_boxcar_t *f, uint16_t sample);
+void Filter_Median3Init(filter_median3_t *f);
+uint16_t Filter_Median3Update(filter_median3_t *f, uint16_t sample);
+void Filter_Median5Init(filter_median5_t *f);
+uint16_t Filter_Median5Update(filter_median5_t *f, uint16_t sample);
+void Filter_IirInit(filter_iir_t *f, uint8_t alpha);
+uint16_t Filter_IirUpdate(filter_iir_t *f, uint16_t sample);
+
+#endif /* FILTER_H_ */
@@ -0,0 +1,95 @@
+/*
+ * RingBuffer.c
+ *
+ * Created: 19/10/2026 09:54:58
+ */
+#include <stddef.h>
+#include "RingBuffer.h"
+
+/**
+ * @brief
+ * @param rb
+ * @param storage
+ * @param size power of two, 2..RING_BUFFER_MAX_SIZE
+ * @return false if size is not valid
+ */
+bool RingBuffer_Init(ring_buffer_t *rb, volatile uint8_t *storage, uint8_t size)
+{
+	if((storage == NULL) || (size < 2) || (size > RING_BUFFER_MAX_SIZE) || (size & (size - 1)))
+	{
+		return false;
+	}
+	rb->Buffer = storage;
+	rb->Mask = size - 1;
+	rb->Head = 0;
+	rb->Tail = 0;
+	return true;
+}
+
+/**
+ * @brief Producer side. The data is stored before Head is published.
+ * @param rb
+ * @param data
+ * @return false if the buffer is full
+ */
+bool RingBuffer_Put(ring_buffer_t *rb, uint8_t data)
+{
+	uint8_t head = rb->Head;
+
+	if((uint8_t)(head - rb->Tail) > rb->Mask)
+	{
+		return false;
+	}
+	rb->Buffer[head & rb->Mask] = data;
+	rb->Head = head + 1;
+	return true;
+}
+
+/**
+ * @brief Consumer side. The data is read before Tail releases the slot.
+ * @param rb
+ * @param data
+ * @return false if the buffer is empty
+ */
+bool RingBuffer_Get(ring_buffer_t *rb, uint8_t *data)
+{
+	uint8_t tail = rb->Tail;
+
+	if(tail == rb->Head)
+	{
+		return false;
+	}
+	*data = rb->Buffer[tail & rb->Mask];
+	rb->Tail = tail + 1;
+	return true;
+}
+
+/**
+ * @brief
+ * @param rb
+ * @return
+ */
+uint8_t RingBuffer_Count(const ring_buffer_t *rb)
+{
+	return (uint8_t)(rb->Head - rb->Tail);
+}
+
+/**
+ * @brief
+ * @param rb
+ * @return
+ */
+uint8_t RingBuffer_Free(const ring_buffer_t *rb)
+{
+	return (uint8_t)(rb->Mask + 1 - RingBuffer_Count(rb));
+}
+
+/**
+ * @brief
+ * @param rb
+ * @return
+ */
+bool RingBuffer_IsEmpty(const ring_buffer_t *rb)
+{
+	return (rb->Head == rb->Tail);
+}
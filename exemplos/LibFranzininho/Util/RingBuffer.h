@@ -0,0 +1,36 @@
+/*
+ * RingBuffer.h
+ *
+ * Created: 19/10/2026 09:55:09
+ */
+#ifndef RINGBUFFER_H_
+#define RINGBUFFER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Single producer / single consumer byte FIFO. Head is only written
+ *        by the producer and Tail only by the consumer, both are single
+ *        bytes, so an ISR and the main loop can share it without cli().
+ *        The indices run free and are masked on access; size must be a
+ *        power of two up to 128.
+ */
+typedef struct
+{
+	volatile uint8_t *Buffer;
+	volatile uint8_t Head;
+	volatile uint8_t Tail;
+	uint8_t Mask;
+}ring_buffer_t;
+
+#define RING_BUFFER_MAX_SIZE	128
+
+bool RingBuffer_Init(ring_buffer_t *rb, volatile uint8_t *storage, uint8_t size);
+bool RingBuffer_Put(ring_buffer_t *rb, uint8_t data);
+bool RingBuffer_Get(ring_buffer_t *rb, uint8_t *data);
+uint8_t RingBuffer_Count(const ring_buffer_t *rb);
+uint8_t RingBuffer_Free(const ring_buffer_t *rb);
+bool RingBuffer_IsEmpty(const ring_buffer_t *rb);
+
+#endif /* RINGBUFFER_H_ */
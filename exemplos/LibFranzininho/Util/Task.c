@@ -0,0 +1,54 @@
+/*
+ * Task.c
+ *
+ * Created: 19/10/2026 10:05:48
+ */
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "Task.h"
+#include "../../LibFranzininho/Franzininho.h"
+
+static volatile uint16_t Task_Ticks = 0;
+
+/**
+ * @brief Starts the Timer driver with Task_Tick as its callback
+ */
+void Task_Init(void)
+{
+	Timer_SetCallback(Task_Tick);
+	Timer_Init(TASK_TIMER_PRESCALER);
+}
+
+/**
+ * @brief Advances the task clock, call it from the Timer callback
+ */
+void Task_Tick(void)
+{
+	Task_Ticks++;
+}
+
+/**
+ * @brief
+ * @return ticks since Task_Init, wraps every 65536 ticks
+ */
+uint16_t Task_Now(void)
+{
+	uint16_t now;
+	uint8_t sreg = SREG;
+
+	cli();
+	now = Task_Ticks;
+	SREG = sreg;
+	return now;
+}
+
+/**
+ * @brief Idle sleep until the next interrupt. Call it at the end of the
+ *        main loop when every task is waiting on time or on an ISR.
+ */
+void Task_Idle(void)
+{
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	sleep_mode();
+}
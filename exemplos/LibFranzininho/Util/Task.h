@@ -0,0 +1,82 @@
+/*
+ * Task.h
+ *
+ * Created: 19/10/2026 10:06:02
+ */
+#ifndef TASK_H_
+#define TASK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Stackless cooperative tasks (protothreads). A task is a function
+ *        that takes its task_t and is called over and over from the main
+ *        loop; the TASK_ macros return from it while it waits and jump back
+ *        to the same line on the next call. Each task costs sizeof(task_t),
+ *        4 bytes of RAM, and shares the single stack with everything else.
+ *
+ *        uint8_t Blink(task_t *t)
+ *        {
+ *            TASK_BEGIN(t);
+ *            while(1)
+ *            {
+ *                DigitalPin_Toggle(LED_BOARD);
+ *                TASK_SLEEP_MS(t, 500);
+ *            }
+ *            TASK_END(t);
+ *        }
+ *
+ * Local variables are not kept across a wait, make them static. A switch
+ * statement cannot contain a wait. Time comes from Task_Tick: Task_Init
+ * installs it as the Timer callback with TASK_TIMER_PRESCALER, or call it
+ * from your own callback if the Timer is shared. Sleeps up to 65535 ticks.
+ */
+/** @brief Tick source, override both together */
+#ifndef TASK_TIMER_PRESCALER
+#define TASK_TIMER_PRESCALER	TIMER_PRESCALER_64
+#define TASK_TICK_HZ			(F_CPU / 64 / 256)		// 1007 Hz at 16.5 MHz
+#endif
+
+/** @brief Milliseconds to ticks, rounded; the tick is 0.993 ms at 16.5 MHz */
+#define TASK_MS(ms)				((uint16_t)(((uint32_t)(ms) * TASK_TICK_HZ + 500) / 1000))
+
+#define TASK_WAITING			0
+#define TASK_ENDED				1
+
+/** @brief */
+typedef struct
+{
+	uint16_t Line;				// where to resume, 0 = start
+	uint16_t Start;				// tick the current sleep began
+}task_t;
+
+#define TASK_INIT(t)			do { (t)->Line = 0; } while(0)
+
+#define TASK_BEGIN(t)			switch((t)->Line) { case 0:
+
+#define TASK_END(t)				} (t)->Line = 0; return TASK_ENDED
+
+/** @brief Returns now, resumes after this line on the next call */
+#define TASK_YIELD(t)			do { (t)->Line = __LINE__; return TASK_WAITING; case __LINE__:; } while(0)
+
+#define TASK_WAIT_UNTIL(t, cond)	do { (t)->Line = __LINE__; case __LINE__: if(!(cond)) { return TASK_WAITING; } } while(0)
+
+#define TASK_WAIT_WHILE(t, cond)	TASK_WAIT_UNTIL(t, !(cond))
+
+#define TASK_SLEEP_TICKS(t, ticks)	do { (t)->Start = Task_Now(); TASK_WAIT_UNTIL(t, (uint16_t)(Task_Now() - (t)->Start) >= (uint16_t)(ticks)); } while(0)
+
+#define TASK_SLEEP_MS(t, ms)	TASK_SLEEP_TICKS(t, TASK_MS(ms))
+
+/** @brief Starts the task over from TASK_BEGIN on the next call */
+#define TASK_RESTART(t)			do { (t)->Line = 0; return TASK_WAITING; } while(0)
+
+/** @brief Ends the task, like reaching TASK_END */
+#define TASK_EXIT(t)			do { (t)->Line = 0; return TASK_ENDED; } while(0)
+
+void Task_Init(void);
+void Task_Tick(void);
+uint16_t Task_Now(void);
+void Task_Idle(void);
+
+#endif /* TASK_H_ */
@@ -0,0 +1,14 @@
+/*
+ * interrupt.h
+ *
+ * Host stand-in for <avr/interrupt.h>: an ISR becomes a function named
+ * after its vector that the test calls directly.
+ */
+#ifndef STUB_AVR_INTERRUPT_H_
+#define STUB_AVR_INTERRUPT_H_
+
+#define ISR(vector)		void vector(void); void vector(void)
+#define cli()
+#define sei()
+
+#endif
@@ -0,0 +1,24 @@
+/*
+ * io.h
+ *
+ * Host stand-in for <avr/io.h>: the registers the tested drivers touch are
+ * plain variables defined by the test.
+ */
+#ifndef STUB_AVR_IO_H_
+#define STUB_AVR_IO_H_
+
+#include <stdint.h>
+
+extern volatile uint8_t PINB, PORTB, DDRB, PCMSK, GIMSK, GIFR, SREG;
+
+#define PB0		0
+#define PB1		1
+#define PB2		2
+#define PB3		3
+#define PB4		4
+#define PB5		5
+#define PCIE	5
+#define PCIF	5
+#define E2END	511
+
+#endif
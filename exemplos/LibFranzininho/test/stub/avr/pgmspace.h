@@ -0,0 +1,14 @@
+/*
+ * pgmspace.h
+ *
+ * Host stand-in for <avr/pgmspace.h>
+ */
+#ifndef STUB_AVR_PGMSPACE_H_
+#define STUB_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr)		(*(const uint8_t *)(addr))
+
+#endif
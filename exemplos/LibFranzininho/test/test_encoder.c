@@ -0,0 +1,195 @@
+/*
+ * test_encoder.c
+ *
+ * Host tests for the transition table decoder in Driver/Encoder.c. The
+ * ISR is called directly after each change of the simulated PINB.
+ */
+#include <stdio.h>
+#include <avr/io.h>
+#include "Franzininho.h"
+
+volatile uint8_t PINB, PORTB, DDRB, PCMSK, GIMSK, GIFR, SREG;
+
+void PCINT0_vect(void);
+
+static int failures = 0;
+
+#define CHECK(cond, ...)	do { if(!(cond)) { printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); failures++; } } while(0)
+
+/* one quadrature cycle with A leading B: AB = 00, 10, 11, 01 */
+static const uint8_t forward[4] = {0x0, 0x2, 0x3, 0x1};
+
+static void set_pins(uint8_t ab)
+{
+	PINB = (uint8_t)((((ab >> 1) & 1) << ENCODER_PIN_A) | ((ab & 1) << ENCODER_PIN_B));
+	PCINT0_vect();
+}
+
+static void start(uint8_t ab)
+{
+	PINB = (uint8_t)((((ab >> 1) & 1) << ENCODER_PIN_A) | ((ab & 1) << ENCODER_PIN_B));
+	Encoder_Init(1);
+}
+
+/* every valid single step, from every state, in both directions */
+static void test_single_steps(void)
+{
+	int i;
+
+	for(i = 0; i < 4; i++)
+	{
+		start(forward[i]);
+		set_pins(forward[(i + 1) & 3]);
+		CHECK(Encoder_GetPosition() == 1, "forward from state %d: %d", i, Encoder_GetPosition());
+
+		start(forward[i]);
+		set_pins(forward[(i + 3) & 3]);
+		CHECK(Encoder_GetPosition() == -1, "reverse from state %d: %d", i, Encoder_GetPosition());
+		CHECK(Encoder_GetErrors() == 0, "errors on valid steps");
+	}
+}
+
+static void test_turns(void)
+{
+	int i;
+
+	start(forward[0]);
+	for(i = 1; i <= 4 * 100; i++)
+	{
+		set_pins(forward[i & 3]);
+	}
+	CHECK(Encoder_GetPosition() == 400, "100 turns forward: %d", Encoder_GetPosition());
+	for(i = 4 * 100 - 1; i >= 0; i--)
+	{
+		set_pins(forward[i & 3]);
+	}
+	CHECK(Encoder_GetPosition() == 0, "and back: %d", Encoder_GetPosition());
+	CHECK(Encoder_GetErrors() == 0, "errors on turns");
+}
+
+/* contact bounce on one pin must cancel out */
+static void test_bounce(void)
+{
+	int i;
+
+	start(forward[0]);
+	set_pins(forward[1]);
+	for(i = 0; i < 7; i++)
+	{
+		set_pins(forward[0]);
+		set_pins(forward[1]);
+	}
+	CHECK(Encoder_GetPosition() == 1, "bounce: %d", Encoder_GetPosition());
+}
+
+/* both pins changing at once: no count, one error; interrupt with no change: nothing */
+static void test_invalid(void)
+{
+	int i;
+
+	for(i = 0; i < 4; i++)
+	{
+		start(forward[i]);
+		set_pins(forward[(i + 2) & 3]);
+		CHECK(Encoder_GetPosition() == 0, "skipped edge counted from %d", i);
+		CHECK(Encoder_GetErrors() == 1, "skipped edge not reported from %d", i);
+		set_pins(forward[(i + 2) & 3]);
+		CHECK((Encoder_GetPosition() == 0) && (Encoder_GetErrors() == 1), "no change counted from %d", i);
+	}
+}
+
+/*
+ * High step rates: the pins move twice between two interrupts, so the ISR
+ * sees a skipped state. Each skip must count nothing and report one error,
+ * never a step in the wrong direction, and the next single step must be
+ * decoded from the state actually read. The true position is then always
+ * the decoded one plus two counts per error.
+ */
+static void run_merged(int dir)
+{
+	uint32_t seed = 12345;
+	int16_t last;
+	int phase = 0;
+	int i;
+
+	start(forward[0]);
+	last = Encoder_GetPosition();
+	for(i = 0; i < 1000; i++)
+	{
+		seed = seed * 1103515245UL + 12345;
+		phase += dir * (((seed >> 16) % 3 == 0) ? 2 : 1);	// a third of the interrupts merge two edges
+		set_pins(forward[phase & 3]);
+
+		CHECK(dir * (Encoder_GetPosition() - last) >= 0, "dir %d: step %d went backwards", dir, i);
+		last = Encoder_GetPosition();
+		CHECK(phase == Encoder_GetPosition() + dir * 2 * Encoder_GetErrors(),
+			"dir %d: drift at step %d: true %d, decoded %d, errors %d", dir, i, phase, Encoder_GetPosition(), Encoder_GetErrors());
+		if(Encoder_GetErrors() == 0xFF)
+		{
+			break;
+		}
+	}
+	CHECK(Encoder_GetErrors() > 0, "dir %d: no skipped state was generated", dir);
+}
+
+static void test_merged_edges(void)
+{
+	run_merged(1);
+	run_merged(-1);
+}
+
+/* after a skip, slow single steps are counted again with no offset */
+static void test_resync(void)
+{
+	int i;
+
+	start(forward[0]);
+	set_pins(forward[2]);					// skip
+	for(i = 3; i < 3 + 8; i++)
+	{
+		set_pins(forward[i & 3]);
+	}
+	CHECK((Encoder_GetPosition() == 8) && (Encoder_GetErrors() == 1), "resync: %d, errors %d", Encoder_GetPosition(), Encoder_GetErrors());
+	for(i = 3 + 8 - 2; i >= 2; i--)
+	{
+		set_pins(forward[i & 3]);
+	}
+	CHECK(Encoder_GetPosition() == 0, "resync back: %d", Encoder_GetPosition());
+}
+
+static void test_velocity(void)
+{
+	int i;
+
+	start(forward[0]);
+	Encoder_Init(4);
+	for(i = 1; i <= 10; i++)
+	{
+		set_pins(forward[i & 3]);
+	}
+	for(i = 0; i < 4; i++)
+	{
+		Encoder_Tick();
+	}
+	CHECK(Encoder_GetVelocity() == 10, "velocity %d", Encoder_GetVelocity());
+	Encoder_SetPosition(1000);
+	for(i = 0; i < 4; i++)
+	{
+		Encoder_Tick();
+	}
+	CHECK(Encoder_GetVelocity() == 0, "SetPosition leaked into velocity: %d", Encoder_GetVelocity());
+}
+
+int main(void)
+{
+	test_single_steps();
+	test_turns();
+	test_bounce();
+	test_invalid();
+	test_merged_edges();
+	test_resync();
+	test_velocity();
+
+	printf("test_encoder: %s\n", failures ? "FAILED" : "ok");
+	return failures ? 1 : 0;
+}
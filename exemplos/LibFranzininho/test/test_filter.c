@@ -0,0 +1,172 @@
+/*
+ * test_filter.c
+ *
+ * Host tests for Util/Filter.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "Util/Filter.h"
+
+static int failures = 0;
+
+#define CHECK(cond, ...)	do { if(!(cond)) { printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); failures++; } } while(0)
+
+static int compare(const void *a, const void *b)
+{
+	return (int)*(const uint16_t *)a - (int)*(const uint16_t *)b;
+}
+
+static uint16_t reference_median(const uint16_t *window, int n)
+{
+	uint16_t sorted[5];
+	int i;
+
+	for(i = 0; i < n; i++)
+	{
+		sorted[i] = window[i];
+	}
+	qsort(sorted, n, sizeof(sorted[0]), compare);
+	return sorted[n / 2];
+}
+
+/* every window of values 0..3 (covers ties) must give the sorted median */
+static void test_median_windows(void)
+{
+	uint16_t window[5];
+	filter_median3_t m3;
+	filter_median5_t m5;
+	uint16_t out;
+	int code;
+	int i;
+
+	for(code = 0; code < 4 * 4 * 4; code++)
+	{
+		Filter_Median3Init(&m3);
+		for(i = 0; i < 3; i++)
+		{
+			window[i] = (code >> (2 * i)) & 3;
+			out = Filter_Median3Update(&m3, window[i]);
+		}
+		CHECK(out == reference_median(window, 3), "median3 window %d got %u", code, out);
+	}
+
+	for(code = 0; code < 4 * 4 * 4 * 4 * 4; code++)
+	{
+		Filter_Median5Init(&m5);
+		for(i = 0; i < 5; i++)
+		{
+			window[i] = (code >> (2 * i)) & 3;
+			out = Filter_Median5Update(&m5, window[i]);
+		}
+		CHECK(out == reference_median(window, 5), "median5 window %d got %u", code, out);
+	}
+}
+
+/* a running median must drop spikes and follow a step after n/2 samples */
+static void test_median_step(void)
+{
+	filter_median3_t m3;
+	filter_median5_t m5;
+	uint16_t input[] = {100, 100, 100, 900, 100, 100, 0, 0, 100, 100, 500, 500, 500, 500};
+	uint16_t out3;
+	uint16_t out5;
+	unsigned i;
+
+	Filter_Median3Init(&m3);
+	Filter_Median5Init(&m5);
+	for(i = 0; i < sizeof(input) / sizeof(input[0]); i++)
+	{
+		out3 = Filter_Median3Update(&m3, input[i]);
+		out5 = Filter_Median5Update(&m5, input[i]);
+		if((i >= 4) && (i <= 9))
+		{
+			CHECK(out5 == 100, "median5 spike leaked at %u: %u", i, out5);
+		}
+		if((i >= 2) && (i <= 5))
+		{
+			CHECK(out3 == 100, "median3 spike leaked at %u: %u", i, out3);
+		}
+	}
+	CHECK(out3 == 500, "median3 step end %u", out3);
+	CHECK(out5 == 500, "median5 step end %u", out5);
+}
+
+/* step response: monotonic, reaches the final value exactly */
+static void test_iir_step(uint8_t alpha, uint16_t from, uint16_t to)
+{
+	filter_iir_t f;
+	uint16_t out = 0;
+	uint16_t last = from;
+	int n;
+
+	Filter_IirInit(&f, alpha);
+	CHECK(Filter_IirUpdate(&f, from) == from, "iir prime alpha %u", alpha);
+	for(n = 0; n < 20000; n++)
+	{
+		out = Filter_IirUpdate(&f, to);
+		CHECK((to > from) ? (out >= last) : (out <= last), "iir alpha %u not monotonic at %d", alpha, n);
+		last = out;
+	}
+	CHECK(out == to, "iir alpha %u step %u->%u settled at %u", alpha, from, to, out);
+}
+
+/* alpha 128 must take about one sample per halving of the error */
+static void test_iir_rate(void)
+{
+	filter_iir_t f;
+	uint16_t out;
+
+	Filter_IirInit(&f, 128);
+	Filter_IirUpdate(&f, 0);
+	out = Filter_IirUpdate(&f, 1000);
+	CHECK((out >= 499) && (out <= 501), "iir alpha 128 first step %u", out);
+}
+
+static void test_ema_boxcar(void)
+{
+	filter_ema_t e;
+	filter_boxcar_t b;
+	uint16_t out = 0;
+	int n;
+
+	Filter_EmaInit(&e, 4);
+	CHECK(Filter_EmaUpdate(&e, 300) == 300, "ema prime");
+	for(n = 0; n < 500; n++)
+	{
+		out = Filter_EmaUpdate(&e, 700);
+	}
+	CHECK((out >= 684) && (out <= 700), "ema settled at %u", out);
+
+	Filter_BoxcarInit(&b);
+	for(n = 0; n < FILTER_BOXCAR_SIZE; n++)
+	{
+		out = Filter_BoxcarUpdate(&b, 1023);
+	}
+	CHECK(out == 1023, "boxcar full scale %u", out);
+	for(n = 0; n < FILTER_BOXCAR_SIZE; n++)
+	{
+		out = Filter_BoxcarUpdate(&b, 0);
+	}
+	CHECK(out == 0, "boxcar back to 0 %u", out);
+}
+
+int main(void)
+{
+	static const uint8_t alphas[] = {1, 2, 3, 16, 100, 255};
+	unsigned i;
+
+	test_median_windows();
+	test_median_step();
+	for(i = 0; i < sizeof(alphas); i++)
+	{
+		test_iir_step(alphas[i], 0, 1000);
+		test_iir_step(alphas[i], 1000, 0);
+		test_iir_step(alphas[i], 1023, 7);
+		test_iir_step(alphas[i], 7, 1023);
+	}
+	test_iir_rate();
+	test_ema_boxcar();
+
+	printf("test_filter: %s\n", failures ? "FAILED" : "ok");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+#
+# ws2812_timing.py
+#
+# Cycle check of the Ws2812_Show bit loop. The instructions are taken from
+# the asm statement in Driver/Ws2812.c, the pad macros are expanded for
+# each supported F_CPU, and the loop is stepped with the ATtiny85 cycle
+# count of every instruction while it sends a few test bytes. The line
+# level follows the "out" instructions. Checked:
+#   - T0H, T1H, T0L, T1L and the bit period against the data sheet windows
+#   - the cycle figures written in Driver/Ws2812.h
+#
+# No avr-gcc / simavr is needed: the loop is hand written asm, so the
+# assembler emits exactly these instructions.
+
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, '..', 'Driver', 'Ws2812.c')
+HEADER = os.path.join(HERE, '..', 'Driver', 'Ws2812.h')
+
+# WS2812 data sheet: 0.35 / 0.7 us high, 0.8 / 0.6 us low, +-0.15 us;
+# bit period 1.25 us +-0.6 us. A longer low phase only matters once it
+# gets near the latch (reset) time, so the low times are bounded at 5 us
+# and the period window is not applied to the last bit of a byte.
+T0H = (0.20, 0.50)
+T1H = (0.55, 0.85)
+T0L = (0.65, 5.0)
+T1L = (0.45, 5.0)
+PERIOD = (0.65, 1.85)
+
+BYTES = [0x00, 0xFF, 0xA5, 0x5A]
+
+CYCLES = {'out': 1, 'nop': 1, 'rjmp': 2, 'dec': 1, 'lsl': 1, 'ldi': 1, 'ld': 2, 'sbiw': 2}
+
+failures = 0
+
+
+def fail(msg):
+    global failures
+    print('FAIL ws2812_timing: ' + msg)
+    failures += 1
+
+
+def strings(text):
+    return ''.join(re.findall(r'"((?:[^"\\]|\\.)*)"', text))
+
+
+def pads(source):
+    """{f_cpu: {'T0H': asm, ...}} from the #if / #elif F_CPU chain"""
+    macros = dict(re.findall(r'#define\s+(WS2812_NOP\d)\s+("[^"]*")', source))
+    table = {}
+    current = None
+    for line in source.splitlines():
+        m = re.match(r'#(?:el)?if\s+\(F_CPU == (\d+)', line)
+        if m:
+            current = table.setdefault(int(m.group(1)), {})
+            continue
+        m = re.match(r'#define\s+WS2812_PAD_(\w+)\s+(.*?)\s*(/\*.*)?$', line)
+        if m and current is not None:
+            body = m.group(2)
+            for name, value in macros.items():
+                body = body.replace(name, value)
+            current[m.group(1)] = strings(body)
+    return table
+
+
+def loop(source, pad):
+    """instruction list of the asm statement in Ws2812_Show"""
+    body = source[source.index('void Ws2812_Show'):]
+    body = body[body.index('asm volatile('):]
+    body = body[:body.index('\n\t\t:')]
+    for name, value in pad.items():
+        body = body.replace('WS2812_PAD_' + name, '"' + value + '"')
+    return [i.strip() for i in strings(body).split('\\n\\t') if i.strip()]
+
+
+def run(program, data):
+    """steps the loop, returns [(time, level)] of every output change"""
+    labels = {}
+    for n, ins in enumerate(program):
+        if ins.endswith(':'):
+            labels[ins[:-1]] = n
+
+    def jump(target):
+        return labels[target[:-1]]     # "1b" / "2f", each label is defined once
+
+    byte = data[0]
+    ptr = 1
+    count = len(data)
+    bit = 8
+    zero = False
+    level = 0
+    edges = []
+    t = 0
+    pc = 0
+    while pc < len(program):
+        ins = program[pc]
+        if ins.endswith(':'):
+            pc += 1
+            continue
+        op, _, args = ins.partition(' ')
+        args = args.strip()
+        nxt = pc + 1
+        cost = CYCLES.get(op)
+        if op == 'out':
+            new = 1 if args.endswith('%[hi]') else 0
+            if new != level:
+                edges.append((t, new))
+                level = new
+        elif op == 'rjmp':
+            if args != '.+0':
+                nxt = jump(args)
+        elif op == 'sbrs':
+            cost = 1
+            if byte & 0x80:
+                cost = 2
+                nxt = pc + 2
+        elif op == 'dec':
+            bit = (bit - 1) & 0xFF
+            zero = bit == 0
+        elif op == 'lsl':
+            byte = (byte << 1) & 0xFF
+        elif op == 'ld':
+            byte = data[ptr] if ptr < len(data) else 0
+            ptr += 1
+        elif op == 'ldi':
+            bit = int(args.split(',')[1])
+        elif op == 'sbiw':
+            count -= 1
+            zero = count == 0
+        elif op in ('breq', 'brne'):
+            taken = zero if op == 'breq' else not zero
+            cost = 2 if taken else 1
+            if taken:
+                nxt = jump(args)
+        elif op != 'nop':
+            fail('unknown instruction "%s"' % ins)
+            return edges
+        t += cost
+        pc = nxt
+    return edges
+
+
+def claims(header):
+    """{f_cpu: (t0h, t1h, period)} and byte end cycles written in Ws2812.h"""
+    table = {}
+    for mhz, a, b, c in re.findall(r'\*\s+([\d.]+) MHz:\s+(\d+) /\s+(\d+) /\s+(\d+) cycles', header):
+        table[int(round(float(mhz) * 1e6))] = (int(a), int(b), int(c))
+    m = re.search(r'takes (\d+)\s*\*?\s*cycles \(8 MHz: (\d+)\)', header)
+    return table, (int(m.group(1)), int(m.group(2))) if m else None
+
+
+def within(name, f_cpu, cycles, window):
+    us = cycles * 1e6 / f_cpu
+    if not (window[0] <= us <= window[1]):
+        fail('%.1f MHz %s %d cycles = %.3f us, outside %.2f..%.2f us' % (f_cpu / 1e6, name, cycles, us, window[0], window[1]))
+
+
+def main():
+    source = open(SOURCE).read()
+    header = open(HEADER).read()
+    written, byte_end = claims(header)
+    table = pads(source)
+    if sorted(table) != [8000000, 16000000, 16500000]:
+        fail('F_CPU chain not found: %s' % sorted(table))
+    for f_cpu, pad in sorted(table.items()):
+        edges = run(loop(source, pad), BYTES)
+        bits = [(byte >> (7 - i)) & 1 for byte in BYTES for i in range(8)]
+        rises = [t for t, level in edges if level == 1]
+        falls = [t for t, level in edges if level == 0]
+        if len(rises) != len(bits) or len(falls) != len(bits):
+            fail('%d bits sent, %d pulses seen' % (len(bits), len(rises)))
+            continue
+        high = {0: set(), 1: set()}
+        periods = set()
+        ends = set()
+        for n, value in enumerate(bits):
+            high[value].add(falls[n] - rises[n])
+            if n + 1 < len(bits):
+                period = rises[n + 1] - rises[n]
+                (ends if n % 8 == 7 else periods).add(period)
+                within('T%dL' % value, f_cpu, period - (falls[n] - rises[n]), T1L if value else T0L)
+        if len(high[0]) != 1 or len(high[1]) != 1 or len(periods) != 1 or len(ends) != 1:
+            fail('%.1f MHz timing not constant: %s %s %s %s' % (f_cpu / 1e6, high[0], high[1], periods, ends))
+            continue
+        t0h, t1h, period, end = high[0].pop(), high[1].pop(), periods.pop(), ends.pop()
+        within('T0H', f_cpu, t0h, T0H)
+        within('T1H', f_cpu, t1h, T1H)
+        within('bit period', f_cpu, period, PERIOD)
+        if written.get(f_cpu) != (t0h, t1h, period):
+            fail('%.1f MHz: Ws2812.h says %s, loop gives %s' % (f_cpu / 1e6, written.get(f_cpu), (t0h, t1h, period)))
+        if byte_end is not None:
+            expected = byte_end[1] if f_cpu == 8000000 else byte_end[0]
+            if end != expected:
+                fail('%.1f MHz: Ws2812.h says byte end %d, loop gives %d' % (f_cpu / 1e6, expected, end))
+        print('ws2812 %4.1f MHz: T0H %2d  T1H %2d  period %2d  byte end %2d cycles' % (f_cpu / 1e6, t0h, t1h, period, end))
+    print('ws2812_timing: %s' % ('FAILED' if failures else 'ok'))
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
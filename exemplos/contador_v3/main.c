@@ -2,107 +2,116 @@
  * 
  * @file main.c
  * @author Eduardo Dueñas
- * @brief Exemplo de contador de eventos com tratamento por interrupção
- * @version 1.0
+ * @brief Exemplo de contador de eventos com tarefas cooperativas
+ * @version 2.0
  * @date 20/04/2021
  * 
  * O programa é um desenvolvimento em cima do contador_v2 uma com alterações no loop infinito que 
- * havia ficdo em aberto para outras aplicações para o modo sleep para diminuira o gasto de energia e
- * alterar o debouce para interrupção, aumentando a eficiência do código. O código pode ser usado com 
- * outras aplicações no lugar do sleep.
+ * havia ficdo em aberto para outras aplicações para o modo sleep para diminuira o gasto de energia.
+ * Na versão 2.0 o debounce, antes dividido entre as interrupções INT0 e TIMER0_OVF, virou uma
+ * tarefa (Util/Task.h) escrita de forma sequencial: espera o botão, espera 20 ms, confere e espera
+ * soltar. Outras aplicações podem rodar simultaneamente como novas tarefas no loop principal.
+ * Enquanto a tarefa só espera o botão o tick é desligado e o microcontrolador dorme até a
+ * interrupção INT0, como na versão 1.0; o tick de ~1 ms só roda durante o debounce.
  * 
  */
 
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <avr/sleep.h>
+#include "LibFranzininho/Franzininho.h"
 
-#define F_CPU 16500000L
-
- 	
 #define setBit(valor,bit) (valor |= (1<<bit))
 #define clearBit(valor,bit) (valor &= ~(1<<bit))
 #define toogleBit(valor,bit) (valor ^= (1<<bit))
 #define testBit(valor,bit)    (valor & (1<<bit))
 
-volatile unsigned char count = 0;
-volatile unsigned char test = 0;
-unsigned int pin = 0;
+#define BOTAO       PB2
+#define DEBOUNCE    20          // ms que o botão precisa ficar estável
 
+unsigned char count = 0;
+unsigned char esperaBotao = 0;  //1 enquanto a tarefa espera o botão ser apertado
 
-//Debounce do push button para desconciderarmos ruido e bouncing do botão
-char debounce(int pino){
-    pin=pino;
-    //Coloca um timer para cada 1000 ciclos de clk para testar o push buttom
-    TCNT0=131;                  //256-(1000/8)=131
-    setBit(TIMSK,TOIE0);        //Habilita interrupções por timer overflow
-    test=0;
+
+ISR(INT0_vect){             //Só acorda o microcontrolador
+    clearBit(GIMSK,INT0);
 }
 
 
-ISR(INT0_vect){             //Tratamento de interrupções de pulso externo
-    clearBit(GIMSK,INT0);    //Desabilita interrupções do INT0 durante o tratamento da interrupção
-    debounce(PB2);/*
-    if(debounce(PB2)){      //Se o botão foi realmente apertado incrementa cont e manda para os leds
-        count++;
-        count %= 0x10;
-        PORTB = ((PORTB & 0xE7) | ((count>>2)<<3));
-        PORTB = ((PORTB & 0xFC) | (count&0x03));
-    }
-    sei();                  // Reabilita interrupções globais
-    */
+//Mostra count nos leds de PB[4:3] e PB[1:0]
+void mostra(void){
+    PORTB = ((PORTB & 0xE7) | ((count>>2)<<3));
+    PORTB = ((PORTB & 0xFC) | (count&0x03));
 }
 
 
-ISR(TIMER0_OVF_vect){       //Tratamento de interrupções de timer overflow
-    if(testBit(PINB,pin)){
-        test++;
-        if(test>=20){
+//Debounce do push button para desconciderarmos ruido e bouncing do botão
+uint8_t botao(task_t *t){
+    TASK_BEGIN(t);
+    for(;;){
+        esperaBotao = 1;
+        TASK_WAIT_UNTIL(t, testBit(PINB,BOTAO));    //Espera a borda de subida
+        esperaBotao = 0;
+        TASK_SLEEP_MS(t, DEBOUNCE);
+        if(testBit(PINB,BOTAO)){                    //Se o botão foi realmente apertado incrementa cont e manda para os leds
             count++;
             count %= 0x10;
-            PORTB = ((PORTB & 0xE7) | ((count>>2)<<3));
-            PORTB = ((PORTB & 0xFC) | (count&0x03));
-            clearBit(TIMSK,TOIE0);  //Desabilita interrupções por timer overflow
-            setBit(GIMSK,INT0);     //Reabilita interrupções externas no INT0
+            mostra();
         }
+        TASK_WAIT_WHILE(t, testBit(PINB,BOTAO));    //Espera soltar o botão
+        TASK_SLEEP_MS(t, DEBOUNCE);
     }
-    else{
-        clearBit(TIMSK,TOIE0);  //Desabilita interrupções por timer overflow
-        setBit(GIMSK,INT0);     //Reabilita interrupções externas no INT0
-    }
-
+    TASK_END(t);
 }
 
 
+//Desliga o tick e dorme até a borda de subida no INT0
+void dormeAteBotao(void){
+    cli();
+    clearBit(TIMSK,TOIE0);      //Sem tick: nada a fazer até o botão
+    GIFR = (1<<INTF0);
+    setBit(GIMSK,INT0);
+    if(!testBit(PINB,BOTAO)){   //Confere com as interrupções desligadas para não perder a borda
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        sleep_enable();
+        sei();
+        sleep_cpu();
+        sleep_disable();
+    }
+    cli();
+    clearBit(GIMSK,INT0);
+    setBit(TIMSK,TOIE0);        //Religa o tick para o debounce
+    sei();
+}
+
 
 int main(void){
+    task_t tarefaBotao;
+
     //Configuração de PORTB
-    clearBit(DDRB,PB2);     //Configura PB2 como saida
-    setBit(DDRB,PB0);       //Configura PB0 como entrada
-    setBit(DDRB,PB1);       //Configura PB1 como entrada
-    setBit(DDRB,PB3);       //Configura PB3 como entrada
-    setBit(DDRB,PB4);       //Configura PB4 como entrada
+    clearBit(DDRB,PB2);     //Configura PB2 como entrada
+    setBit(DDRB,PB0);       //Configura PB0 como saida
+    setBit(DDRB,PB1);       //Configura PB1 como saida
+    setBit(DDRB,PB3);       //Configura PB3 como saida
+    setBit(DDRB,PB4);       //Configura PB4 como saida
 
     PORTB &= 0xE4;          //Manda 0 para PB[4:3] e PB[1:0]
 
-    //Configuração do timer
-    TCCR0A=0x00;                //Modo Normal
-    TCCR0B=0x00;
-    TCCR0B |= 0x02;             //Prescaler de 8
-
-
-    //Configuração do modo sleep
-    clearBit(MCUCR,SM0);        //Configura sleep mode como idle
-    clearBit(MCUCR,SM1);
-
-    //Configuração de Interrupção externa
-    setBit(GIMSK,INT0);     //Habilita interrupções externas no INT0
-    MCUCR |= 0x03;          //Seta interrupções para borda de subida
-    sei();                  //Habilita interrupções globais
+    //Configuração do tick das tarefas (timer 0, ~1 ms) e das interrupções
+    TASK_INIT(&tarefaBotao);
+    Task_Init();
+    MCUCR |= (1<<ISC01) | (1<<ISC00);  //INT0 na borda de subida
 
 
     for(;;){                   //Loop infinito
-        //Aqui você pode colocar outra aplicação para rodar simultaniamenta ao contador no lugar do sleep
-        sleep_mode();   //entra no sleep mode
+        botao(&tarefaBotao);
+        //Aqui você pode colocar outras tarefas para rodar simultaniamenta ao contador
+        //(com outras tarefas ativas use só Task_Idle, o tick não pode parar)
+        if(esperaBotao){
+            dormeAteBotao();   //entra no sleep mode até o botão
+        }
+        else{
+            Task_Idle();       //entra no sleep mode até o próximo tick
+        }
     }              
-}
\ No newline at end of file
+}
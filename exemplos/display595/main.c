@@ -0,0 +1,37 @@
+/**
+ * 
+ * @file main.c
+ * @brief Exemplo de display de 7 segmentos multiplexado com dois 74HC595
+ * @version 0.1
+ * @date 19/10/2026
+ * 
+ * A varredura dos dígitos é feita pela interrupção do timer 0 através da
+ * display595_Refresh. O loop principal apenas atualiza o valor mostrado.
+ * 
+ */
+
+#include <avr/io.h>
+#include "LibFranzininho/Franzininho.h"
+
+#define CLK P0
+#define DATA P2
+#define LATCH P3
+
+#define DIGITOS 4
+
+int main(void)
+{
+	uint16_t contador = 0;
+
+	display595_Init(CLK, LATCH, DATA, DIGITOS, DISPLAY595_SELECT_ACTIVE_LOW);
+	display595_SetBrightness(DISPLAY595_LEVELS / 2);    // metade do brilho
+
+	Timer_SetCallback(display595_Refresh);
+	Timer_Init(TIMER_PRESCALER_8);                      // tick de 8 kHz
+
+	while (1)
+	{
+		display595_PrintUint(contador++);               // só atualiza o buffer
+		Clock_DelayMs(100);
+	}
+}
@@ -6,7 +6,6 @@
  */ 
 
 #include <avr/io.h>
-#include <util/delay.h>
 #include "LibFranzininho/Franzininho.h"
 
 
@@ -16,17 +15,47 @@
 
 uint8_t data = 0;
 
+/* Cada comportamento é uma tarefa com seu próprio tempo (aqui os dois
+   500 ms do exemplo original): enquanto uma espera, a outra roda.
+   Variáveis locais não sobrevivem a uma espera. */
+uint8_t Pisca(task_t *t)
+{
+	TASK_BEGIN(t);
+	while (1)
+	{
+		DigitalPin_Toggle(LED_BOARD);
+		TASK_SLEEP_MS(t, 500);
+	}
+	TASK_END(t);
+}
+
+uint8_t Contador(task_t *t)
+{
+	TASK_BEGIN(t);
+	while (1)
+	{
+		ci74hc595_Transmits_8_Bits(data++);
+		TASK_SLEEP_MS(t, 500);
+	}
+	TASK_END(t);
+}
+
 int main(void)
 {
+	task_t pisca;
+	task_t contador;
+
 	DigitalPin_Init(LED_BOARD,OUTPUT);
 	ci74hc595_Init(CLK,LATCH,DATA);
+
+	TASK_INIT(&pisca);
+	TASK_INIT(&contador);
+	Task_Init();                    // tick de ~1 ms no timer 0
 	
     while (1) 
     {
-		
-		DigitalPin_Toggle(LED_BOARD);
-		ci74hc595_Transmits_8_Bits(data++);
-		_delay_ms(500);      	
+		Pisca(&pisca);
+		Contador(&contador);
+		Task_Idle();                // dorme até o próximo tick
     }
-}
-
+}
\ No newline at end of file